@@ -548,6 +548,132 @@ nonius::benchmark bench_rttr_find_method_cross_cast_neg_level_6()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename Class_Type, std::size_t Member_Count>
+nonius::benchmark bench_linear_find_method_by_name()
+{
+    return nonius::benchmark("linear search - method", [](nonius::chronometer meter)
+    {
+        Class_Type obj;
+        const std::string name = "method_" + std::to_string(Member_Count - 1);
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (const auto& meth : rttr::type::get(obj).get_methods())
+            {
+                if (meth.get_name() == name)
+                {
+                    value = 1;
+                    break;
+                }
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, std::size_t Member_Count>
+nonius::benchmark bench_rttr_find_method_by_name()
+{
+    return nonius::benchmark("rttr - method", [](nonius::chronometer meter)
+    {
+        Class_Type obj;
+        const std::string name = "method_" + std::to_string(Member_Count - 1);
+        volatile std::size_t value = 0;
+        rttr::method m = rttr::type::get(nullptr).get_method("");
+        meter.measure([&]()
+        {
+            if ((m = rttr::type::get(obj).get_method(name)))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, std::size_t Member_Count>
+nonius::benchmark bench_linear_find_property_by_name()
+{
+    return nonius::benchmark("linear search - property", [](nonius::chronometer meter)
+    {
+        Class_Type obj;
+        const std::string name = "property_" + std::to_string(Member_Count - 1);
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (const auto& prop : rttr::type::get(obj).get_properties())
+            {
+                if (prop.get_name() == name)
+                {
+                    value = 1;
+                    break;
+                }
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, std::size_t Member_Count>
+nonius::benchmark bench_rttr_find_property_by_name()
+{
+    return nonius::benchmark("rttr - property", [](nonius::chronometer meter)
+    {
+        Class_Type obj;
+        const std::string name = "property_" + std::to_string(Member_Count - 1);
+        volatile std::size_t value = 0;
+        rttr::property p = rttr::type::get(nullptr).get_property("");
+        meter.measure([&]()
+        {
+            if ((p = rttr::type::get(obj).get_property(name)))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, std::size_t Member_Count>
+static void bench_find_by_name_group(nonius::configuration& cfg, nonius::html_group_reporter& reporter)
+{
+    const auto count = std::to_string(Member_Count);
+    const auto last_index = std::to_string(Member_Count - 1);
+    reporter.set_current_group_name("lookup by name - " + count + " members",
+                                    "benchmark code:"
+                                    "<pre>"
+                                    "// class with " + count + " registered properties and methods\n"
+                                    "\n"
+                                    "// linear search\n"
+                                    "for (auto& meth : rttr::type::get(obj).get_methods())\n"
+                                    "    if (meth.get_name() == \"method_" + last_index + "\")\n"
+                                    "        return true;\n"
+                                    "\n"
+                                    "// rttr approach\n"
+                                    "if (rttr::type::get(obj).get_method(\"method_" + last_index + "\"))\n"
+                                    "    return true;\n"
+                                    "</pre>");
+
+    nonius::benchmark benchmarks_group[] = { bench_linear_find_method_by_name<Class_Type, Member_Count>(),
+                                             bench_rttr_find_method_by_name<Class_Type, Member_Count>(),
+                                             bench_linear_find_property_by_name<Class_Type, Member_Count>(),
+                                             bench_rttr_find_property_by_name<Class_Type, Member_Count>() };
+
+    nonius::go(cfg, std::begin(benchmarks_group), std::end(benchmarks_group), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void bench_find_method()
 {
     nonius::configuration cfg;
@@ -906,5 +1032,11 @@ void bench_find_method()
 
     nonius::go(cfg, std::begin(benchmarks_group_6_neg), std::end(benchmarks_group_6_neg), reporter);
 
+    /////////////////////////////////////
+
+    bench_find_by_name_group<ns_foo::lookup_class_10, 10>(cfg, reporter);
+    bench_find_by_name_group<ns_foo::lookup_class_100, 100>(cfg, reporter);
+    bench_find_by_name_group<ns_foo::lookup_class_1000, 1000>(cfg, reporter);
+
     reporter.generate_report();
 }
@@ -0,0 +1,161 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_method/test_methods.h"
+
+#include <rttr/registration>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <iostream>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static int g_sealed_bench_value = 42;
+
+static int sealed_bench_add(int a, int b)
+{
+    return (a + b);
+}
+
+RTTR_REGISTRATION
+{
+    rttr::registration::property("g_sealed_bench_value", &g_sealed_bench_value)
+                       .method("sealed_bench_add", &sealed_bench_add);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * All benchmarks with \p Sealed == true seal the registry before their measurement starts;
+ * so they have to run after all other benchmarks.
+ */
+template<bool Sealed>
+static void prepare_registry()
+{
+    if (Sealed)
+        rttr::registration::seal();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<bool Sealed>
+static std::string get_sealed_name(const std::string& name)
+{
+    return (name + (Sealed ? " - sealed" : " - unsealed"));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<bool Sealed>
+nonius::benchmark bench_type_get_by_name()
+{
+    return nonius::benchmark(get_sealed_name<Sealed>("type::get_by_name"), [](nonius::chronometer meter)
+    {
+        prepare_registry<Sealed>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (rttr::type::get_by_name("ns_foo::method_class"))
+                value = 1;
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<bool Sealed>
+nonius::benchmark bench_type_get_global_property()
+{
+    return nonius::benchmark(get_sealed_name<Sealed>("type::get_global_property"), [](nonius::chronometer meter)
+    {
+        prepare_registry<Sealed>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (rttr::type::get_global_property("g_sealed_bench_value"))
+                value = 1;
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<bool Sealed>
+nonius::benchmark bench_type_invoke()
+{
+    return nonius::benchmark(get_sealed_name<Sealed>("type::invoke"), [](nonius::chronometer meter)
+    {
+        prepare_registry<Sealed>();
+        meter.measure([&]()
+        {
+            return rttr::type::invoke("sealed_bench_add", {1, 2});
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_sealed_registry()
+{
+    nonius::configuration cfg;
+    cfg.title = "sealed registry";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_sealed_registry.html");
+
+    const auto memory_before = rttr::registration::get_memory_usage();
+
+    reporter.set_current_group_name("lookup by name - unsealed vs. sealed",
+                                    "benchmark code:"
+                                    "<pre>"
+                                    "rttr::type::get_by_name(\"ns_foo::method_class\");\n"
+                                    "rttr::type::get_global_property(\"g_sealed_bench_value\");\n"
+                                    "rttr::type::invoke(\"sealed_bench_add\", {1, 2});\n"
+                                    "\n"
+                                    "// the sealed benchmarks call 'rttr::registration::seal()' before the measurement"
+                                    "</pre>");
+
+    // the unsealed benchmarks have to come first, because the registry cannot be unsealed again
+    nonius::benchmark benchmarks_group_1[] = { bench_type_get_by_name<false>(),
+                                               bench_type_get_global_property<false>(),
+                                               bench_type_invoke<false>(),
+                                               bench_type_get_by_name<true>(),
+                                               bench_type_get_global_property<true>(),
+                                               bench_type_invoke<true>() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    const auto memory_after = rttr::registration::get_memory_usage();
+    std::cout << "registration tables: " << memory_before << " bytes before sealing, "
+              << memory_after << " bytes after sealing" << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -27,12 +27,15 @@
 
 extern void bench_method();
 extern void bench_invoke_method();
+extern void bench_sealed_registry();
 /////////////////////////////////////////////////////////////////////////////////////////
 
 int main(int /* argc */, char** /* argv */)
 {
     bench_method();
     bench_invoke_method();
+    // seals the registry, therefore it has to be the last benchmark
+    bench_sealed_registry();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
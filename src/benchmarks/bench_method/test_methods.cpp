@@ -29,6 +29,34 @@
 
 #include <rttr/registration>
 
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, std::size_t Member_Count>
+static void register_lookup_class(rttr::string_view class_name)
+{
+    using namespace rttr;
+
+    // the registered names are not copied, so they have to outlive the registration
+    static std::vector<std::string> prop_names;
+    static std::vector<std::string> meth_names;
+    for (std::size_t i = 0; i < Member_Count; ++i)
+    {
+        prop_names.push_back("property_" + std::to_string(i));
+        meth_names.push_back("method_" + std::to_string(i));
+    }
+
+    registration::class_<Class_Type> reg(class_name);
+    for (std::size_t i = 0; i < Member_Count; ++i)
+    {
+        reg.property(prop_names[i], &Class_Type::value);
+        reg.method(meth_names[i], &Class_Type::method);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
 
 RTTR_REGISTRATION
 {
@@ -83,6 +111,9 @@ RTTR_REGISTRATION
     CLASS_REGISTER(class_multiple_final, 18)
     CLASS_REGISTER(class_multiple_final_D, 19)
 
+    register_lookup_class<ns_foo::lookup_class_10, 10>("ns_foo::lookup_class_10");
+    register_lookup_class<ns_foo::lookup_class_100, 100>("ns_foo::lookup_class_100");
+    register_lookup_class<ns_foo::lookup_class_1000, 1000>("ns_foo::lookup_class_1000");
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +165,18 @@ struct class_multiple_final_D : class_multiple_final
     RTTR_ENABLE(class_multiple_final)
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// classes used to measure the name lookup of class items,
+// the number in the class name is the amount of registered properties and methods
+#define LOOKUP_CLASS(CLASS_NAME) struct CLASS_NAME { void method() { } int value = 0; RTTR_ENABLE() };
+
+LOOKUP_CLASS(lookup_class_10)
+LOOKUP_CLASS(lookup_class_100)
+LOOKUP_CLASS(lookup_class_1000)
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace ns_foo
 
 #define CLASS_REGISTER(CLASS_NAME, NUMBER) \
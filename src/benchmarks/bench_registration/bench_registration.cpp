@@ -0,0 +1,206 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_registration/test_classes.h"
+
+#include <rttr/registration>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <deque>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+// every sample registers its own hierarchy, the additional ones are needed by nonius,
+// in order to estimate the number of iterations per sample
+static const int sample_count = 10;
+static const std::size_t hierarchy_count = sample_count + 2;
+
+static const std::size_t member_count = 20;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static string_view store_name(std::string name)
+{
+    // the registered names are not copied, so they have to outlive the registration;
+    // a deque will not move its elements on insertion
+    static std::deque<std::string> names;
+    names.push_back(std::move(name));
+    return names.back();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void register_hierarchy_class(std::size_t level_index)
+{
+    const auto prefix = "_" + std::to_string(level_index) + "_";
+    static std::size_t class_counter = 0;
+    registration::class_<T> reg(store_name("hierarchy_class_" + std::to_string(++class_counter)));
+    for (std::size_t i = 0; i < member_count; ++i)
+    {
+        reg.property(store_name("property" + prefix + std::to_string(i)), &T::value);
+        reg.method(store_name("method" + prefix + std::to_string(i)), &T::method);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Tag, std::size_t Level>
+struct hierarchy_registration
+{
+    static void apply()
+    {
+        hierarchy_registration<Tag, Level - 1>::apply();
+        register_hierarchy_class<hierarchy_class<Tag, level<Level>>>(Level);
+    }
+};
+
+template<typename Tag>
+struct hierarchy_registration<Tag, 0>
+{
+    static void apply()
+    {
+        register_hierarchy_class<hierarchy_class<Tag, level<0>>>(0);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The functions to set up, register and check one hierarchy;
+ * only \ref register_items is measured.
+ */
+struct hierarchy_funcs
+{
+    type (*get_leaf_type)();
+    void (*register_items)();
+};
+
+template<std::size_t Depth, bool Use_Batch, std::size_t Index>
+static type get_leaf_type()
+{
+    // retrieving the most derived type makes all classes of the hierarchy known;
+    // then every registered item of a base class has to update all its derived classes
+    return type::get<hierarchy_class<hierarchy_tag<Depth, Use_Batch, Index>, level<Depth>>>();
+}
+
+template<std::size_t Depth, bool Use_Batch, std::size_t Index>
+static void register_items()
+{
+    using tag = hierarchy_tag<Depth, Use_Batch, Index>;
+    if (Use_Batch)
+    {
+        detail::registration_batch batch;
+        hierarchy_registration<tag, Depth>::apply();
+    }
+    else
+    {
+        hierarchy_registration<tag, Depth>::apply();
+    }
+}
+
+template<std::size_t Depth, bool Use_Batch, std::size_t... Index>
+static std::vector<hierarchy_funcs> create_hierarchy_pool(detail::index_sequence<Index...>)
+{
+    return { hierarchy_funcs{ &get_leaf_type<Depth, Use_Batch, Index>, &register_items<Depth, Use_Batch, Index> }... };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t Depth, bool Use_Batch>
+nonius::benchmark bench_registration()
+{
+    return nonius::benchmark(Use_Batch ? "batch" : "per item", [](nonius::chronometer meter)
+    {
+        static const auto pool = create_hierarchy_pool<Depth, Use_Batch>(detail::make_index_sequence<hierarchy_count>());
+        static std::size_t next_index = 0;
+
+        const auto runs = static_cast<std::size_t>(meter.runs());
+        if (next_index + runs > pool.size())
+        {
+            std::cerr << "error: no unregistered hierarchy of depth " << Depth << " left" << std::endl;
+            return;
+        }
+
+        std::vector<type> leaf_types;
+        for (std::size_t i = 0; i < runs; ++i)
+            leaf_types.push_back(pool[next_index + i].get_leaf_type());
+
+        meter.measure([&](int i)
+        {
+            pool[next_index + i].register_items();
+        });
+
+        for (const auto& leaf_type : leaf_types)
+        {
+            if (leaf_type.get_properties().size() != (Depth + 1) * member_count)
+                std::cerr << "error: wrong number of inherited properties for " << leaf_type.get_name() << std::endl;
+        }
+
+        next_index += runs;
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t Depth>
+static void bench_registration_group(const nonius::configuration& cfg, nonius::html_group_reporter& reporter)
+{
+    const auto depth = std::to_string(Depth);
+    reporter.set_current_group_name("hierarchy depth " + depth,
+                                    "Registration of " + std::to_string(member_count) + " properties and methods<br>"
+                                    "for every class of a single inheritance hierarchy, which is " + depth + " levels deep.<br>"
+                                    "All classes are known before the registration starts.");
+
+    nonius::benchmark benchmarks_group[] = { bench_registration<Depth, false>(), bench_registration<Depth, true>() };
+    nonius::go(cfg, std::begin(benchmarks_group), std::end(benchmarks_group), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void start_registration_benchmark()
+{
+    nonius::configuration cfg;
+    cfg.title = "registration of class hierarchies";
+    cfg.samples = sample_count;
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_registration.html");
+
+    bench_registration_group<5>(cfg, reporter);
+    bench_registration_group<10>(cfg, reporter);
+    bench_registration_group<20>(cfg, reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
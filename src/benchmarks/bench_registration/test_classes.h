@@ -0,0 +1,70 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_REGISTRATION_TEST_CLASSES_H_
+#define RTTR_REGISTRATION_TEST_CLASSES_H_
+
+#include <rttr/type>
+
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// Synthetic single inheritance hierarchies, used to measure the registration time.
+// 'hierarchy_class<Tag, level<N>>' derives from 'hierarchy_class<Tag, level<N - 1>>',
+// every 'Tag' creates a new independent hierarchy (see 'hierarchy_tag').
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+using level = std::integral_constant<std::size_t, N>;
+
+template<typename Tag, typename Level>
+struct hierarchy_class : hierarchy_class<Tag, level<Level::value - 1>>
+{
+    void method() { }
+    int value = 0;
+
+    RTTR_ENABLE(hierarchy_class<Tag, level<Level::value - 1>>)
+};
+
+template<typename Tag>
+struct hierarchy_class<Tag, level<0>>
+{
+    virtual ~hierarchy_class() { }
+    void method() { }
+    int value = 0;
+
+    RTTR_ENABLE()
+};
+
+/*!
+ * Every benchmark sample needs a hierarchy, whose classes have no registered items yet;
+ * so every combination of \p Depth, \p Use_Batch and \p Index creates a new hierarchy.
+ */
+template<std::size_t Depth, bool Use_Batch, std::size_t Index>
+struct hierarchy_tag { };
+
+#endif // RTTR_REGISTRATION_TEST_CLASSES_H_
@@ -861,6 +861,307 @@ nonius::benchmark bench_level_6_type()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<std::size_t Depth>
+bench_data<ClassDepth<level<0>>> setup_depth_class_hierachy()
+{
+    std::vector<std::shared_ptr<ClassDepth<level<0>>> > vec;
+    vec.reserve(ITEM_COUNT * 2);
+    for (int i = 0; i < ITEM_COUNT; ++i)
+    {
+        vec.push_back(std::make_shared<ClassDepth<level<Depth>>>());
+        vec.push_back(std::make_shared<ClassDepth<level<Depth - 1>>>());
+    }
+
+    return bench_data<ClassDepth<level<0>>>{std::move(vec)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t Depth>
+nonius::benchmark bench_depth_dynamic_cast()
+{
+    return nonius::benchmark("dynamic_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_depth_class_hierachy<Depth>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (dynamic_cast<ClassDepth<level<Depth>>*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t Depth>
+nonius::benchmark bench_depth_rttr_cast()
+{
+    return nonius::benchmark("rttr_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_depth_class_hierachy<Depth>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (rttr_cast<ClassDepth<level<Depth>>*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t Depth>
+nonius::benchmark bench_depth_is_derived_from()
+{
+    return nonius::benchmark("type::is_derived_from", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_depth_class_hierachy<Depth>();
+        const type target_type = type::get<ClassDepth<level<Depth>>>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (type::get(*bench_data.m_vec[i]).is_derived_from(target_type))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t Depth>
+void bench_depth_group(const nonius::configuration& cfg, nonius::html_group_reporter& reporter)
+{
+    const auto group_name = "hierarchy depth " + std::to_string(Depth);
+    const auto tooltip = "A cast from the base class " + std::to_string(Depth) + " hierarchy level(s) down;<br>"
+                         "half of the casts fail, because the object is one level too shallow.";
+    reporter.set_current_group_name(group_name, tooltip);
+    nonius::benchmark benchmarks[] = { bench_depth_dynamic_cast<Depth>(), bench_depth_rttr_cast<Depth>(), bench_depth_is_derived_from<Depth>() };
+    nonius::go(cfg, std::begin(benchmarks), std::end(benchmarks), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bench_data<ClassWide01> setup_wide_class_hierachy()
+{
+    std::vector<std::shared_ptr<ClassWide01> > vec;
+    vec.reserve(ITEM_COUNT * 2);
+    for (int i = 0; i < ITEM_COUNT; ++i)
+    {
+        vec.push_back(std::make_shared<ClassWideFinal>());
+        vec.push_back(std::make_shared<ClassWide01>());
+    }
+
+    return bench_data<ClassWide01>{std::move(vec)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_wide_multiple_inheritance_dynamic_cast()
+{
+    return nonius::benchmark("dynamic_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_wide_class_hierachy();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (dynamic_cast<ClassWide16*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_wide_multiple_inheritance_rttr_cast()
+{
+    return nonius::benchmark("rttr_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_wide_class_hierachy();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (rttr_cast<ClassWide16*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_wide_multiple_inheritance_is_derived_from()
+{
+    return nonius::benchmark("type::is_derived_from", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_wide_class_hierachy();
+        const type target_type = type::get<ClassWide16>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (type::get(*bench_data.m_vec[i]).is_derived_from(target_type))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bench_data<ClassMultipleBaseA> setup_static_offset_class_hierachy()
+{
+    std::vector<std::shared_ptr<ClassMultipleBaseA> > vec;
+    vec.reserve(ITEM_COUNT);
+    for (int i = 0; i < ITEM_COUNT; ++i)
+        vec.push_back(std::make_shared<FinalClass>());
+
+    return bench_data<ClassMultipleBaseA>{std::move(vec)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_static_offset_dynamic_cast()
+{
+    return nonius::benchmark("dynamic_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_static_offset_class_hierachy();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (dynamic_cast<ClassMultipleBaseE*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_static_offset_rttr_cast()
+{
+    return nonius::benchmark("rttr_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_static_offset_class_hierachy();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (rttr_cast<ClassMultipleBaseE*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bench_data<ClassDiamondLeft1> setup_virtual_offset_class_hierachy()
+{
+    std::vector<std::shared_ptr<ClassDiamondLeft1> > vec;
+    vec.reserve(ITEM_COUNT);
+    for (int i = 0; i < ITEM_COUNT; ++i)
+        vec.push_back(std::make_shared<ClassDiamondFinal>());
+
+    return bench_data<ClassDiamondLeft1>{std::move(vec)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_virtual_offset_dynamic_cast()
+{
+    return nonius::benchmark("dynamic_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_virtual_offset_class_hierachy();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (dynamic_cast<ClassDiamondTop*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_virtual_offset_rttr_cast()
+{
+    return nonius::benchmark("rttr_cast", [](nonius::chronometer meter)
+    {
+        auto bench_data = setup_virtual_offset_class_hierachy();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (rttr_cast<ClassDiamondTop*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -916,6 +1217,32 @@ void start_rttr_cast_benchmark()
     nonius::benchmark benchmarks_group_9[] = { bench_cross_cast_dynamic_cast_2(), bench_cross_cast_rttr_cast_2() };
     nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
 
+    ///////////////////////////////////////////////////////////////////////////////
+
+    bench_depth_group<1>(cfg, reporter);
+    bench_depth_group<5>(cfg, reporter);
+    bench_depth_group<10>(cfg, reporter);
+    bench_depth_group<15>(cfg, reporter);
+    bench_depth_group<20>(cfg, reporter);
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    reporter.set_current_group_name("wide multiple inheritance", "A cross cast from the first to the last base class<br>of a class, which is derived from 16 classes.");
+    nonius::benchmark benchmarks_group_10[] = { bench_wide_multiple_inheritance_dynamic_cast(), bench_wide_multiple_inheritance_rttr_cast(), bench_wide_multiple_inheritance_is_derived_from() };
+    nonius::go(cfg, std::begin(benchmarks_group_10), std::end(benchmarks_group_10), reporter);
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    reporter.set_current_group_name("static pointer offset", "A cross cast of the most derived object between two non-virtual base classes;<br>"
+                                                             "rttr_cast only adds the offset, which was computed during registration.");
+    nonius::benchmark benchmarks_group_11[] = { bench_static_offset_dynamic_cast(), bench_static_offset_rttr_cast() };
+    nonius::go(cfg, std::begin(benchmarks_group_11), std::end(benchmarks_group_11), reporter);
+
+    reporter.set_current_group_name("virtual base pointer offset", "An upcast of the most derived object to its virtual base class;<br>"
+                                                                   "rttr_cast has to call the registered cast function.");
+    nonius::benchmark benchmarks_group_12[] = { bench_virtual_offset_dynamic_cast(), bench_virtual_offset_rttr_cast() };
+    nonius::go(cfg, std::begin(benchmarks_group_12), std::end(benchmarks_group_12), reporter);
+
     reporter.generate_report();
 }
 
@@ -30,6 +30,8 @@
 
 #include <rttr/type>
 
+#include <type_traits>
+
 #if RTTR_COMPILER == RTTR_COMPILER_CLANG
 #   pragma GCC diagnostic push
 #   pragma GCC diagnostic ignored "-Wunused-private-field"
@@ -165,6 +167,54 @@ CLASS_INHERIT(ClassDiamondRight6, ClassDiamondRight5)
 
 CLASS_MULTI_INHERIT_3(ClassDiamondFinal, ClassDiamondLeft5, ClassDiamondMiddle5, ClassDiamondRight5)
 
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following class template creates single inheritance hierarchies of arbitrary depth;
+// 'ClassDepth<level<N>>' derives from 'ClassDepth<level<N - 1>>'
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+using level = std::integral_constant<std::size_t, N>;
+
+template<typename Level>
+struct ClassDepth : ClassDepth<level<Level::value - 1>>
+{
+    virtual int getType() { return static_cast<int>(Level::value); }
+    RTTR_ENABLE(ClassDepth<level<Level::value - 1>>)
+    double dummyDoubleValue;
+};
+
+template<>
+struct ClassDepth<level<0>>
+{
+    virtual ~ClassDepth() {}
+    virtual int getType() { return 0; }
+    RTTR_ENABLE()
+    int dummyIntValue;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following class structure is 1 hierarchy level deep and 16 classes wide;
+// the final class uses multiple inheritance to combine all classes
+/////////////////////////////////////////////////////////////////////////////////////////
+
+CLASS(ClassWide01) CLASS(ClassWide02) CLASS(ClassWide03) CLASS(ClassWide04)
+CLASS(ClassWide05) CLASS(ClassWide06) CLASS(ClassWide07) CLASS(ClassWide08)
+CLASS(ClassWide09) CLASS(ClassWide10) CLASS(ClassWide11) CLASS(ClassWide12)
+CLASS(ClassWide13) CLASS(ClassWide14) CLASS(ClassWide15) CLASS(ClassWide16)
+
+struct ClassWideFinal : ClassWide01, ClassWide02, ClassWide03, ClassWide04,
+                        ClassWide05, ClassWide06, ClassWide07, ClassWide08,
+                        ClassWide09, ClassWide10, ClassWide11, ClassWide12,
+                        ClassWide13, ClassWide14, ClassWide15, ClassWide16
+{
+    virtual int getType() { return 1; }
+    RTTR_ENABLE(ClassWide01, ClassWide02, ClassWide03, ClassWide04,
+                ClassWide05, ClassWide06, ClassWide07, ClassWide08,
+                ClassWide09, ClassWide10, ClassWide11, ClassWide12,
+                ClassWide13, ClassWide14, ClassWide15, ClassWide16)
+    bool dummyBoolValue;
+};
+
 #if RTTR_COMPILER == RTTR_COMPILER_CLANG
 #   pragma GCC diagnostic pop
 #endif
@@ -361,6 +361,92 @@ nonius::benchmark bench_variant_string_to_bool()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+struct point_2d { int x; int y; };
+struct size_2d  { int width; int height; };
+struct rect_2d  { point_2d pos; size_2d size; };
+
+static size_2d point_to_size(const point_2d& value, bool& ok)   { ok = true; return size_2d{value.x, value.y}; }
+static point_2d size_to_point(const size_2d& value, bool& ok)   { ok = true; return point_2d{value.width, value.height}; }
+static rect_2d point_to_rect(const point_2d& value, bool& ok)   { ok = true; return rect_2d{value, size_2d{0, 0}}; }
+static rect_2d size_to_rect(const size_2d& value, bool& ok)     { ok = true; return rect_2d{point_2d{0, 0}, value}; }
+static point_2d rect_to_point(const rect_2d& value, bool& ok)   { ok = true; return value.pos; }
+static size_2d rect_to_size(const rect_2d& value, bool& ok)     { ok = true; return value.size; }
+static std::string point_to_string(const point_2d& value, bool& ok)
+{
+    ok = true;
+    return std::to_string(value.x) + "," + std::to_string(value.y);
+}
+static std::string size_to_string(const size_2d& value, bool& ok)
+{
+    ok = true;
+    return std::to_string(value.width) + "x" + std::to_string(value.height);
+}
+
+RTTR_REGISTRATION
+{
+    rttr::type::register_converter_func(point_to_size);
+    rttr::type::register_converter_func(size_to_point);
+    rttr::type::register_converter_func(point_to_rect);
+    rttr::type::register_converter_func(size_to_rect);
+    rttr::type::register_converter_func(rect_to_point);
+    rttr::type::register_converter_func(rect_to_size);
+    rttr::type::register_converter_func(point_to_string);
+    rttr::type::register_converter_func(size_to_string);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_custom_type_conversion()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        point_2d var{1, 2};
+        size_2d result{0, 0};
+        bool ok = false;
+        meter.measure([&]()
+        {
+            result = point_to_size(var, ok);
+            return result.width;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_custom_type_conversion()
+{
+    return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
+    {
+        rttr::variant var = point_2d{1, 2};
+        size_2d result{0, 0};
+        meter.measure([&]()
+        {
+            result = var.convert<size_2d>();
+            return result.width;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_custom_type_can_convert_neg()
+{
+    return nonius::benchmark("rttr::variant - no converter", [](nonius::chronometer meter)
+    {
+        rttr::variant var = rect_2d{point_2d{1, 2}, size_2d{3, 4}};
+        volatile bool result = false;
+        meter.measure([&]()
+        {
+            result = var.can_convert<std::string>();
+            return result;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void bench_variant_conversion()
 {
     nonius::configuration cfg;
@@ -451,6 +537,22 @@ void bench_variant_conversion()
 
     //////////////////////////////////
 
+    reporter.set_current_group_name("custom type conversion", "Converts a custom type with a registered converter function:<br><pre>"
+                                    "size_2d point_to_size(const point_2d& value, bool& ok);\n"
+                                    "rttr::type::register_converter_func(point_to_size);\n"
+                                    "\n"
+                                    "rttr::variant var = point_2d{1, 2};\n"
+                                    "var.convert&lt;size_2d&gt;();</pre>");
+
+    nonius::benchmark benchmarks_group_9[] = { bench_native_custom_type_conversion(),
+                                               bench_variant_custom_type_conversion(),
+                                               bench_variant_custom_type_can_convert_neg()
+                                              };
+
+    nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
+
+    //////////////////////////////////
+
     reporter.generate_report();
 }
 
@@ -185,6 +185,18 @@ class flat_multimap
             return m_value_list;
         }
 
+        void shrink_to_fit()
+        {
+            m_key_list.shrink_to_fit();
+            m_value_list.shrink_to_fit();
+        }
+
+        //! Returns the amount of bytes, which are reserved for the key and the value list
+        std::size_t get_memory_usage() const
+        {
+            return (m_key_list.capacity() * sizeof(key_data_type) + m_value_list.capacity() * sizeof(Value));
+        }
+
     private:
 
         const_iterator_key find_key_const(const Key& key) const
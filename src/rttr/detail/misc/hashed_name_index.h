@@ -0,0 +1,167 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_HASHED_NAME_INDEX_H_
+#define RTTR_HASHED_NAME_INDEX_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/string_view.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The hashed_name_index class maps the name of an item to its position inside a contiguous item list.
+ *
+ * It is an open addressing hash table with linear probing; every bucket stores a 32 bit hash value
+ * of the name, so a mismatch is almost always rejected without comparing the name itself.
+ * When a name occurs multiple times in the item list, the index of the first occurrence is stored.
+ * The index has to be rebuilt, whenever an item of the list was changed or removed;
+ * appended items can be added via \ref insert().
+ */
+class hashed_name_index
+{
+    struct bucket
+    {
+        std::uint32_t   m_hash_value;
+        std::uint32_t   m_index;
+    };
+
+    public:
+        static const std::uint32_t npos = static_cast<std::uint32_t>(-1);
+
+        hashed_name_index() : m_mask(0), m_size(0) {}
+
+        template<typename T>
+        void rebuild(const std::vector<T>& items)
+        {
+            clear();
+            reserve(items.size());
+
+            for (std::uint32_t index = 0; index < items.size(); ++index)
+                insert(items, index);
+        }
+
+        /*!
+         * \brief Adds the item at position \p index of \p items to the index;
+         *        nothing happens, when an item with the same name was already added.
+         */
+        template<typename T>
+        void insert(const std::vector<T>& items, std::uint32_t index)
+        {
+            const auto name = items[index].get_name();
+            if (find(name, items.data()) != npos)
+                return;
+
+            reserve(m_size + 1);
+            insert_bucket(bucket{get_hash(name), index});
+            ++m_size;
+        }
+
+        //! Makes room for \p count names, without exceeding the maximum load factor
+        void reserve(std::size_t count)
+        {
+            // keep the load factor below 0.5, so the probe sequences stay short
+            std::size_t bucket_count = 4;
+            while (bucket_count < count * 2)
+                bucket_count <<= 1;
+
+            if (bucket_count <= m_buckets.size())
+                return;
+
+            std::vector<bucket> old_buckets(bucket_count, bucket{0, npos});
+            old_buckets.swap(m_buckets);
+            m_mask = bucket_count - 1;
+            for (const auto& b : old_buckets)
+            {
+                if (b.m_index != npos)
+                    insert_bucket(b);
+            }
+        }
+
+        void clear()
+        {
+            m_buckets.clear();
+            m_buckets.shrink_to_fit();
+            m_mask = 0;
+            m_size = 0;
+        }
+
+        template<typename T>
+        RTTR_INLINE std::uint32_t find(string_view name, const T* items) const RTTR_NOEXCEPT
+        {
+            if (m_buckets.empty())
+                return npos;
+
+            const auto hash_value = get_hash(name);
+            for (std::size_t pos = hash_value & m_mask; ; pos = (pos + 1) & m_mask)
+            {
+                const auto& b = m_buckets[pos];
+                if (b.m_index == npos)
+                    return npos;
+
+                if (b.m_hash_value == hash_value && items[b.m_index].get_name() == name)
+                    return b.m_index;
+            }
+        }
+
+        std::size_t get_memory_usage() const RTTR_NOEXCEPT
+        {
+            return (m_buckets.capacity() * sizeof(bucket));
+        }
+
+    private:
+        static RTTR_INLINE std::uint32_t get_hash(string_view name) RTTR_NOEXCEPT
+        {
+            return static_cast<std::uint32_t>(generate_hash(name.data(), name.size()));
+        }
+
+        void insert_bucket(const bucket& b)
+        {
+            std::size_t pos = b.m_hash_value & m_mask;
+            while (m_buckets[pos].m_index != npos)
+                pos = (pos + 1) & m_mask;
+
+            m_buckets[pos] = b;
+        }
+
+    private:
+        std::vector<bucket> m_buckets;
+        std::size_t         m_mask;
+        std::size_t         m_size;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_HASHED_NAME_INDEX_H_
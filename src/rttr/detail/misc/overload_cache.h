@@ -0,0 +1,170 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_OVERLOAD_CACHE_H_
+#define RTTR_OVERLOAD_CACHE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/string_view.h"
+#include "rttr/type.h"
+
+#include <vector>
+#include <string>
+#include <mutex>
+#include <algorithm>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The overload_cache class remembers the result of an overload resolution,
+ *        i.e. which item was selected for a name together with a list of argument types.
+ *
+ * Negative results (an invalid item) are stored as well.
+ * The cache has to be cleared, whenever an item was registered, which could change the result.
+ * All member functions can be called concurrently.
+ */
+template<typename T>
+class overload_cache
+{
+    struct entry
+    {
+        std::size_t                 m_hash_value;
+        std::string                 m_name;
+        std::vector<type::type_id>  m_arg_ids;
+        T                           m_item;
+    };
+
+    struct order_by_hash
+    {
+        RTTR_INLINE bool operator () (const entry& left, std::size_t right) const { return (left.m_hash_value < right); }
+        RTTR_INLINE bool operator () (std::size_t left, const entry& right) const { return (left < right.m_hash_value); }
+    };
+
+    public:
+        //! The cache is cleared, when it would grow beyond this number of entries
+        static const std::size_t max_entry_count = 256;
+
+        overload_cache() {}
+        overload_cache(const overload_cache&) = delete;
+        overload_cache& operator=(const overload_cache&) = delete;
+
+        /*!
+         * \brief Copies the cached item for \p name and the types of \p args into \p item.
+         *
+         * \return True, when the result for this combination was found in the cache, otherwise false.
+         */
+        template<typename Arg_List>
+        bool find(string_view name, const Arg_List& args, T& item) const
+        {
+            const auto hash_value = get_hash(name, args);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto itr = std::lower_bound(m_entries.cbegin(), m_entries.cend(), hash_value, order_by_hash());
+            for (; itr != m_entries.cend() && itr->m_hash_value == hash_value; ++itr)
+            {
+                if (is_equal(*itr, name, args))
+                {
+                    item = itr->m_item;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        template<typename Arg_List>
+        void insert(string_view name, const Arg_List& args, const T& item)
+        {
+            entry new_entry{get_hash(name, args), name.to_string(), {}, item};
+            new_entry.m_arg_ids.reserve(args.size());
+            for (const auto& arg : args)
+                new_entry.m_arg_ids.push_back(arg.get_type().get_id());
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_entries.size() >= max_entry_count)
+                m_entries.clear();
+
+            auto itr = std::upper_bound(m_entries.begin(), m_entries.end(), new_entry.m_hash_value, order_by_hash());
+            m_entries.insert(itr, std::move(new_entry));
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_entries.clear();
+        }
+
+        std::size_t get_memory_usage() const
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::size_t result = m_entries.capacity() * sizeof(entry);
+            for (const auto& item : m_entries)
+                result += item.m_arg_ids.capacity() * sizeof(type::type_id);
+
+            return result;
+        }
+
+    private:
+        template<typename Arg_List>
+        static RTTR_INLINE std::size_t get_hash(string_view name, const Arg_List& args)
+        {
+            auto hash_value = generate_hash(name.data(), name.size());
+            for (const auto& arg : args)
+                hash_value = (hash_value ^ arg.get_type().get_id()) * static_cast<std::size_t>(0x01000193);
+
+            return hash_value;
+        }
+
+        template<typename Arg_List>
+        static RTTR_INLINE bool is_equal(const entry& item, string_view name, const Arg_List& args)
+        {
+            if (item.m_arg_ids.size() != args.size() || item.m_name != name)
+                return false;
+
+            auto id_itr = item.m_arg_ids.cbegin();
+            for (const auto& arg : args)
+            {
+                if (*id_itr != arg.get_type().get_id())
+                    return false;
+                ++id_itr;
+            }
+
+            return true;
+        }
+
+    private:
+        mutable std::mutex  m_mutex;
+        std::vector<entry>  m_entries; // sorted by 'm_hash_value'
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_OVERLOAD_CACHE_H_
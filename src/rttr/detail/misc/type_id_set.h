@@ -0,0 +1,146 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPE_ID_SET_H_
+#define RTTR_TYPE_ID_SET_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The type_id_set class is a bitset, which is indexed by the id of a type.
+ *
+ * Beside the constant time membership test, it can also return the rank of a contained id,
+ * i.e. the number of smaller ids inside the set, in constant time.
+ * When the set is build from a list of types, which is sorted by id (like the list of base classes),
+ * the rank is the position of the type inside this list.
+ *
+ * The ranks are only computed by \ref rebuild(); a set, which is only filled via \ref insert(),
+ * has no ranks and supports only \ref contains().
+ */
+class type_id_set
+{
+    public:
+        static const std::uint32_t npos = static_cast<std::uint32_t>(-1);
+
+        template<typename T>
+        void rebuild(const std::vector<T>& items)
+        {
+            m_words.clear();
+            m_ranks.clear();
+            for (const auto& item : items)
+                set_bit(item.get_id());
+
+            update_ranks();
+        }
+
+        /*!
+         * \brief Adds \p id to the set, without updating the ranks.
+         */
+        void insert(std::size_t id)
+        {
+            set_bit(id);
+        }
+
+        RTTR_INLINE bool contains(std::size_t id) const RTTR_NOEXCEPT
+        {
+            const std::size_t word_index = id / 64;
+            return (word_index < m_words.size() && (m_words[word_index] & (std::uint64_t(1) << (id % 64))));
+        }
+
+        /*!
+         * \brief Returns the number of ids which are smaller then \p id,
+         *        or \ref npos, when \p id is not contained in the set.
+         *
+         * \remark Can only be used, when the set was created via \ref rebuild().
+         */
+        RTTR_INLINE std::uint32_t rank(std::size_t id) const RTTR_NOEXCEPT
+        {
+            if (!contains(id))
+                return npos;
+
+            const std::size_t word_index = id / 64;
+            const std::uint64_t lower_bits = m_words[word_index] & ((std::uint64_t(1) << (id % 64)) - 1);
+            return (m_ranks[word_index] + count_bits(lower_bits));
+        }
+
+        void shrink_to_fit()
+        {
+            m_words.shrink_to_fit();
+            m_ranks.shrink_to_fit();
+        }
+
+        std::size_t get_memory_usage() const RTTR_NOEXCEPT
+        {
+            return (m_words.capacity() * sizeof(std::uint64_t) + m_ranks.capacity() * sizeof(std::uint32_t));
+        }
+
+    private:
+        void set_bit(std::size_t id)
+        {
+            const std::size_t word_index = id / 64;
+            if (word_index >= m_words.size())
+                m_words.resize(word_index + 1, 0);
+
+            m_words[word_index] |= (std::uint64_t(1) << (id % 64));
+        }
+
+        void update_ranks()
+        {
+            m_ranks.resize(m_words.size());
+            std::uint32_t count = 0;
+            for (std::size_t i = 0; i < m_words.size(); ++i)
+            {
+                m_ranks[i] = count;
+                count += count_bits(m_words[i]);
+            }
+        }
+
+        static RTTR_INLINE std::uint32_t count_bits(std::uint64_t value) RTTR_NOEXCEPT
+        {
+            value = value - ((value >> 1) & 0x5555555555555555ULL);
+            value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+            value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<std::uint32_t>((value * 0x0101010101010101ULL) >> 56);
+        }
+
+    private:
+        std::vector<std::uint64_t> m_words;
+        std::vector<std::uint32_t> m_ranks; // number of set bits in all previous words
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPE_ID_SET_H_
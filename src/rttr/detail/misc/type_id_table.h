@@ -0,0 +1,109 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPE_ID_TABLE_H_
+#define RTTR_TYPE_ID_TABLE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The type_id_table class is a read-only table, which maps the id of a type to one or more items.
+ *
+ * The ids and the items are stored in two separate contiguous arrays, which are sorted by id.
+ * A lookup performs a binary search over the compact id array only and touches the item array
+ * just for the found entry.
+ */
+template<typename T>
+class type_id_table
+{
+    public:
+        using id_type = std::uint16_t;
+        static const std::size_t npos = static_cast<std::size_t>(-1);
+
+        void reserve(std::size_t count)
+        {
+            m_ids.reserve(count);
+            m_items.reserve(count);
+        }
+
+        /*!
+         * \brief Appends the given \p item for the type with the id \p id.
+         *
+         * The items have to be appended in ascending order of their ids.
+         */
+        void push_back(id_type id, T item)
+        {
+            m_ids.push_back(id);
+            m_items.push_back(std::move(item));
+        }
+
+        void shrink_to_fit()
+        {
+            m_ids.shrink_to_fit();
+            m_items.shrink_to_fit();
+        }
+
+        /*!
+         * \brief Returns the position of the first item for the type with the id \p id,
+         *        or \ref npos, when there is no such item.
+         */
+        RTTR_INLINE std::size_t find(id_type id) const RTTR_NOEXCEPT
+        {
+            const auto itr = std::lower_bound(m_ids.cbegin(), m_ids.cend(), id);
+            if (itr != m_ids.cend() && *itr == id)
+                return static_cast<std::size_t>(itr - m_ids.cbegin());
+
+            return npos;
+        }
+
+        RTTR_INLINE std::size_t size() const RTTR_NOEXCEPT { return m_ids.size(); }
+        RTTR_INLINE id_type get_id(std::size_t index) const RTTR_NOEXCEPT { return m_ids[index]; }
+        RTTR_INLINE const T& get_item(std::size_t index) const RTTR_NOEXCEPT { return m_items[index]; }
+
+        std::size_t get_memory_usage() const RTTR_NOEXCEPT
+        {
+            return (m_ids.capacity() * sizeof(id_type) + m_items.capacity() * sizeof(T));
+        }
+
+    private:
+        std::vector<id_type>    m_ids;
+        std::vector<T>          m_items;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPE_ID_TABLE_H_
@@ -51,7 +51,8 @@ template<typename ClassType, typename AccClassType>
 enable_if_t<!contains<AccClassType, typename ClassType::base_class_list>::value, void>
 register_member_accessor_class_type_when_needed_3()
 {
-    base_class_info baseClassInfo = { type::get<AccClassType>(), &rttr_cast_impl<ClassType, AccClassType> };
+    base_class_info baseClassInfo = { type::get<AccClassType>(), &rttr_cast_impl<ClassType, AccClassType>,
+                                      get_base_class_offset<ClassType, AccClassType>() };
     type_register::register_base_class(type::get<ClassType>(), baseClassInfo);
 }
 
@@ -66,7 +67,8 @@ template<typename ClassType, typename AccClassType>
 enable_if_t<!has_base_class_list<ClassType>::value, void>
 register_member_accessor_class_type_when_needed_2()
 {
-    base_class_info baseClassInfo = { type::get<AccClassType>(), &rttr_cast_impl<ClassType, AccClassType> };
+    base_class_info baseClassInfo = { type::get<AccClassType>(), &rttr_cast_impl<ClassType, AccClassType>,
+                                      get_base_class_offset<ClassType, AccClassType>() };
     type_register::register_base_class(type::get<ClassType>(), baseClassInfo);
 }
 
@@ -291,6 +291,7 @@ namespace                                                                \
     {                                                                    \
         rttr__auto__register__()                                         \
         {                                                                \
+            ::rttr::detail::registration_batch batch;                    \
             rttr_auto_register_reflection_function_();                   \
         }                                                                \
     };                                                                   \
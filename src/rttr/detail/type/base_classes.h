@@ -28,19 +28,30 @@
 #ifndef RTTR_BASE_CLASSES_H_
 #define RTTR_BASE_CLASSES_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace rttr
 {
 namespace detail
 {
 
+/*!
+ * The value of \ref base_class_info::m_offset, when the pointer adjustment to the base class
+ * is not known at compile time (e.g. for virtual inheritance).
+ */
+RTTR_CONSTEXPR_OR_CONST std::ptrdiff_t no_static_offset = (std::numeric_limits<std::ptrdiff_t>::max)();
+
 struct base_class_info
 {
-    base_class_info(type t, void*(*rttr_cast_func)(void*))
-    :   m_base_type(t), m_rttr_cast_func(rttr_cast_func)
+    base_class_info(type t, void*(*rttr_cast_func)(void*), std::ptrdiff_t offset = no_static_offset)
+    :   m_base_type(t), m_rttr_cast_func(rttr_cast_func), m_offset(offset)
     {}
     type            m_base_type;
     void*           (*m_rttr_cast_func)(void*);
+    std::ptrdiff_t  m_offset;
 };
 
 /*!
@@ -100,13 +111,67 @@ static void* rttr_cast_impl(void* ptr)
     return static_cast<void*>(static_cast<BaseType*>(static_cast<DerivedType*>(ptr)));
 }
 
+/*!
+ * This trait checks if a pointer to \p BaseType can be down casted via static_cast to \p DerivedType.
+ * This is not the case, when \p BaseType is a virtual (or an ambiguous) base class of \p DerivedType.
+ * Only then, the offset between both class pointers is a compile time constant.
+ */
+template<typename DerivedType, typename BaseType>
+class has_static_base_class_offset_impl
+{
+    typedef char YesType[1];
+    typedef char NoType[2];
+
+    template <typename D, typename B>
+    static YesType& test(decltype(static_cast<D*>(std::declval<B*>())));
+
+    template <typename, typename>
+    static NoType& test(...);
+
+public:
+    static RTTR_CONSTEXPR_OR_CONST bool value = (sizeof(YesType) == sizeof(test<DerivedType, BaseType>(nullptr)));
+};
+
+template<typename DerivedType, typename BaseType>
+using has_static_base_class_offset = std::integral_constant<bool, has_static_base_class_offset_impl<DerivedType, BaseType>::value>;
+
+/*!
+ * Returns the byte offset, which has to be added to a \p DerivedType pointer,
+ * in order to get a pointer to its \p BaseType sub object.
+ *
+ * The pointer used for the calculation is never dereferenced; a non-null address is used,
+ * because the conversion of a null pointer would always result in a null pointer.
+ *
+ * \remark Formally, converting a pointer which does not point to a living \p DerivedType object is undefined behaviour.
+ *         A real object cannot be used here, because \p DerivedType might be abstract or not default constructible.
+ *         This overload is only selected for non-virtual bases (see \ref has_static_base_class_offset);
+ *         for those the conversion is a constant pointer adjustment, which never reads the object
+ *         (the same technique, which is used by the `offsetof` macro of common compilers).
+ */
+template<typename DerivedType, typename BaseType>
+static enable_if_t<has_static_base_class_offset<DerivedType, BaseType>::value, std::ptrdiff_t>
+get_base_class_offset()
+{
+    const std::uintptr_t address = 0x10000;
+    DerivedType* derived_ptr = reinterpret_cast<DerivedType*>(address);
+    BaseType* base_ptr = derived_ptr;
+    return static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(base_ptr) - address);
+}
+
+template<typename DerivedType, typename BaseType>
+static enable_if_t<!has_static_base_class_offset<DerivedType, BaseType>::value, std::ptrdiff_t>
+get_base_class_offset()
+{
+    return no_static_offset;
+}
+
 template<typename DerivedClass, typename BaseClass, typename... U>
 struct type_from_base_classes<DerivedClass, BaseClass, U...>
 {
     static RTTR_INLINE void fill(info_container& vec)
     {
         static_assert(has_base_class_list<BaseClass>::value, "The parent class has no base class list defined - please use the macro RTTR_ENABLE");
-        vec.emplace_back(type::get<BaseClass>(), &rttr_cast_impl<DerivedClass, BaseClass>);
+        vec.emplace_back(type::get<BaseClass>(), &rttr_cast_impl<DerivedClass, BaseClass>, get_base_class_offset<DerivedClass, BaseClass>());
         // retrieve also the types of all base classes of the base classes; you will get an compile error here,
         // when the base class has not defined the 'base_class_list' typedef
         type_from_base_classes<DerivedClass, typename BaseClass::base_class_list>::fill(vec);
@@ -37,6 +37,9 @@
 #include "rttr/detail/type/type_register.h"
 #include "rttr/detail/type/type_name.h"
 #include "rttr/detail/misc/utility.h"
+#include "rttr/detail/misc/hashed_name_index.h"
+#include "rttr/detail/misc/type_id_set.h"
+#include "rttr/detail/misc/overload_cache.h"
 #include "rttr/destructor.h"
 #include "rttr/method.h"
 #include "rttr/property.h"
@@ -77,11 +80,18 @@ struct class_data
     std::vector<type>           m_base_types;
     std::vector<type>           m_derived_types;
     std::vector<rttr_cast_func> m_conversion_list;
+    std::vector<std::ptrdiff_t> m_offset_list; // the static pointer offset to the base class or 'no_static_offset'
     std::vector<property>       m_properties;
     std::vector<method>         m_methods;
     std::vector<constructor>    m_ctors;
     std::vector<type>           m_nested_types;
     destructor                  m_dtor;
+    hashed_name_index           m_property_index; // index into 'm_properties', including inherited items
+    hashed_name_index           m_method_index;   // index into 'm_methods', including inherited items
+    type_id_set                 m_base_type_ids;    // ids of 'm_base_types', the rank is the index into 'm_conversion_list'
+    type_id_set                 m_derived_type_ids; // ids of 'm_derived_types', filled via insert(), i.e. without ranks
+    overload_cache<method>      m_method_cache;     // the methods selected by type::invoke()
+    overload_cache<constructor> m_ctor_cache;       // the constructors selected by type::create()
 };
 
 enum class type_trait_infos : std::size_t
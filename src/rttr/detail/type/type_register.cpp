@@ -139,6 +139,9 @@ void type_register::less_than_comparator(const type& t, type_comparator_base* co
 
 void type_register::register_base_class(const type& derived_type, const base_class_info& base_info)
 {
+    if (type_register_private::is_sealed())
+        return;
+
     auto& class_data = derived_type.m_type_data->get_class_data();
     auto itr = std::find_if(class_data.m_base_types.begin(), class_data.m_base_types.end(),
     [base_info](const type& t)
@@ -149,38 +152,53 @@ void type_register::register_base_class(const type& derived_type, const base_cla
     if (itr != class_data.m_base_types.end()) // already registerd as base class => quit
         return;
 
-    std::vector<std::pair<type, rttr_cast_func>> tmp_sort_vec;
-    using sorted_pair = decltype(tmp_sort_vec)::value_type;
-    if (class_data.m_base_types.size() != class_data.m_conversion_list.size())
+    if (class_data.m_base_types.size() != class_data.m_conversion_list.size() ||
+        class_data.m_base_types.size() != class_data.m_offset_list.size())
         return; // error!!!
 
-    int index = 0;
-    for (const auto& item : class_data.m_base_types)
+    std::vector<base_class_info> tmp_sort_vec;
+    for (std::size_t index = 0; index < class_data.m_base_types.size(); ++index)
     {
-        tmp_sort_vec.emplace_back(item, class_data.m_conversion_list[index]);
-        ++index;
+        tmp_sort_vec.emplace_back(class_data.m_base_types[index], class_data.m_conversion_list[index],
+                                  class_data.m_offset_list[index]);
     }
 
-    tmp_sort_vec.emplace_back(base_info.m_base_type, base_info.m_rttr_cast_func);
+    tmp_sort_vec.push_back(base_info);
     std::sort(tmp_sort_vec.begin(), tmp_sort_vec.end(),
-    [](const sorted_pair& left, const sorted_pair& right)
-    { return left.first.get_id() < right.first.get_id(); });
+    [](const base_class_info& left, const base_class_info& right)
+    { return left.m_base_type.get_id() < right.m_base_type.get_id(); });
 
     class_data.m_base_types.clear();
     class_data.m_conversion_list.clear();
+    class_data.m_offset_list.clear();
 
-    std::transform(tmp_sort_vec.begin(),
-                   tmp_sort_vec.end(),
-                   std::back_inserter(class_data.m_base_types),
-                   [](const sorted_pair& item)-> type { return item.first; });
+    for (const auto& item : tmp_sort_vec)
+    {
+        class_data.m_base_types.push_back(item.m_base_type);
+        class_data.m_conversion_list.push_back(item.m_rttr_cast_func);
+        class_data.m_offset_list.push_back(item.m_offset);
+    }
 
-    std::transform(tmp_sort_vec.begin(),
-                   tmp_sort_vec.end(),
-                   std::back_inserter(class_data.m_conversion_list),
-                   [](const sorted_pair& item)-> rttr_cast_func { return item.second; });
+    class_data.m_base_type_ids.rebuild(class_data.m_base_types);
 
     auto r_type = base_info.m_base_type.get_raw_type();
-    r_type.m_type_data->get_class_data().m_derived_types.push_back(type(derived_type.m_type_data));
+    auto& base_class_data = r_type.m_type_data->get_class_data();
+    base_class_data.m_derived_types.push_back(type(derived_type.m_type_data));
+    base_class_data.m_derived_type_ids.insert(derived_type.get_id());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register::begin_batch()
+{
+    type_register_private::begin_batch();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register::end_batch()
+{
+    type_register_private::end_batch();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -230,9 +248,17 @@ flat_map<std::string, type, hash>& type_register_private::get_custom_name_to_id(
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type_register_private::data_container<type_converter_base>>& type_register_private::get_type_converter_list()
+std::vector<std::vector<type_register_private::converter_entry>>& type_register_private::get_converter_table()
 {
-    static std::vector<data_container<type_converter_base>> obj;
+    static std::vector<std::vector<converter_entry>> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<std::unique_ptr<type_converter_base>>& type_register_private::get_converter_storage()
+{
+    static std::vector<std::unique_ptr<type_converter_base>> obj;
     return obj;
 }
 
@@ -278,6 +304,46 @@ std::vector<type_register_private::data_container<std::vector<metadata>>>& type_
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+type_id_table<const type_comparator_base*>& type_register_private::get_comparator_table()
+{
+    static type_id_table<const type_comparator_base*> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type_id_table<const type_comparator_base*>& type_register_private::get_equal_comparator_table()
+{
+    static type_id_table<const type_comparator_base*> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type_id_table<const type_comparator_base*>& type_register_private::get_less_comparator_table()
+{
+    static type_id_table<const type_comparator_base*> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type_id_table<std::unique_ptr<enumeration_wrapper_base>>& type_register_private::get_enumeration_table()
+{
+    static type_id_table<std::unique_ptr<enumeration_wrapper_base>> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type_id_table<std::unique_ptr<std::vector<metadata>>>& type_register_private::get_metadata_table()
+{
+    static type_id_table<std::unique_ptr<std::vector<metadata>>> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool type_register_private::register_name(uint16_t& id, type_data& info)
 {
     using namespace detail;
@@ -295,7 +361,9 @@ bool type_register_private::register_name(uint16_t& id, type_data& info)
 
     orig_name_to_id.insert(std::make_pair(info.type_name, type(&info)));
     info.name = derive_name(type(&info));
-    get_custom_name_to_id().insert(std::make_pair(info.name, type(&info)));
+    // a sealed registry finds the types via 'get_type_name_index()'
+    if (!is_sealed())
+        get_custom_name_to_id().insert(std::make_pair(info.name, type(&info)));
 
     id = m_type_id_counter;
     info.type_index = id;
@@ -335,10 +403,15 @@ void type_register_private::register_base_class_info(type_data& info)
     {
         class_data.m_base_types.push_back(t.m_base_type);
         class_data.m_conversion_list.push_back(t.m_rttr_cast_func);
+        class_data.m_offset_list.push_back(t.m_offset);
 
         auto r_type = t.m_base_type.get_raw_type();
-        r_type.m_type_data->get_class_data().m_derived_types.push_back(type(&info));
+        auto& base_class_data = r_type.m_type_data->get_class_data();
+        base_class_data.m_derived_types.push_back(type(&info));
+        base_class_data.m_derived_type_ids.insert(info.type_index);
     }
+
+    class_data.m_base_type_ids.rebuild(class_data.m_base_types);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -367,8 +440,11 @@ type type_register_private::register_type(type_data& info) RTTR_NOEXCEPT
     // when a base class type has class items, but the derived one not,
     // we update the derived class item list
     const auto t = type(type_data_container[id]);
-    update_class_list(t, &detail::class_data::m_properties);
-    update_class_list(t, &detail::class_data::m_methods);
+    update_class_list(t);
+
+    // a sealed registry can still get new types, e.g. when a type is used the first time
+    if (is_sealed())
+        get_type_name_index().insert(get_type_storage(), id);
 
     return t;
 }
@@ -501,6 +577,13 @@ void type_register_private::update_custom_name(std::string new_name, const type&
 
     if (new_name != type_name)
     {
+        if (is_sealed())
+        {
+            // only called for a new type, which is not yet part of the type name index
+            type_name = std::move(new_name);
+            return;
+        }
+
         auto& custom_name_to_id = get_custom_name_to_id();
         custom_name_to_id.erase(type_name);
 
@@ -539,7 +622,7 @@ std::string type_register_private::derive_name(const type& t)
 
 void type_register_private::register_custom_name(type& t, string_view custom_name)
 {
-    if (!t.is_valid())
+    if (!t.is_valid() || is_sealed())
         return;
 
     update_custom_name(custom_name.to_string(), t);
@@ -569,11 +652,12 @@ void type_register_private::register_custom_name(type& t, string_view custom_nam
 void type_register_private::constructor(const type& t, std::unique_ptr<constructor_wrapper_base> ctor)
 {
     static std::vector<std::unique_ptr<constructor_wrapper_base> > constructor_list;
-    if (!t.is_valid())
+    if (!t.is_valid() || is_sealed())
         return;
 
     auto& class_data = t.m_type_data->get_class_data();
     class_data.m_ctors.emplace_back(create_item<::rttr::constructor>(ctor.get()));
+    class_data.m_ctor_cache.clear();
     constructor_list.push_back(std::move(ctor));
 }
 
@@ -584,6 +668,8 @@ void type_register_private::constructor(const type& t, std::unique_ptr<construct
 void type_register_private::destructor(const type& t, std::unique_ptr<destructor_wrapper_base> dtor)
 {
     static std::vector<std::unique_ptr<destructor_wrapper_base> > destructor_list;
+    if (is_sealed())
+        return;
 
     auto& dtor_type = t.m_type_data->get_class_data().m_dtor;
     if (!dtor_type) // when no dtor is set at the moment
@@ -616,7 +702,7 @@ static std::vector<std::unique_ptr<detail::property_wrapper_base>>& get_property
 
 void type_register_private::property(const type& t, std::unique_ptr<property_wrapper_base> prop)
 {
-    if (!t.is_valid())
+    if (!t.is_valid() || is_sealed())
         return;
 
     const auto name = prop->get_name();
@@ -630,7 +716,7 @@ void type_register_private::property(const type& t, std::unique_ptr<property_wra
 
         property_list.emplace_back(detail::create_item<::rttr::property>(prop.get()));
         get_property_storage().push_back(std::move(prop));
-        update_class_list(t, &detail::class_data::m_properties);
+        update_class_list(t);
     }
     else
     {
@@ -655,6 +741,14 @@ flat_multimap<string_view, ::rttr::method>& type_register_private::get_global_me
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+overload_cache<::rttr::method>& type_register_private::get_global_method_cache()
+{
+    static overload_cache<::rttr::method> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 static std::vector<std::unique_ptr<method_wrapper_base>>& get_method_storage()
 {
     static std::vector<std::unique_ptr<method_wrapper_base>> container;
@@ -665,7 +759,7 @@ static std::vector<std::unique_ptr<method_wrapper_base>>& get_method_storage()
 
 void type_register_private::method(const type& t, std::unique_ptr<method_wrapper_base> meth)
 {
-    if (!t.is_valid())
+    if (!t.is_valid() || is_sealed())
         return;
 
     const auto name = meth->get_name();
@@ -674,10 +768,12 @@ void type_register_private::method(const type& t, std::unique_ptr<method_wrapper
         if (get_type_method(t, name, convert_param_list(meth->get_parameter_infos())))
             return;
 
-        auto& method_list = t.m_type_data->get_class_data().m_methods;
-        method_list.emplace_back(create_item<::rttr::method>(meth.get()));
+        auto& class_data = t.m_type_data->get_class_data();
+        class_data.m_methods.emplace_back(create_item<::rttr::method>(meth.get()));
+        // the derived classes are cleared, when their class lists are updated
+        class_data.m_method_cache.clear();
         get_method_storage().push_back(std::move(meth));
-        update_class_list(t, &class_data::m_methods);
+        update_class_list(t);
     }
     else
     {
@@ -686,6 +782,7 @@ void type_register_private::method(const type& t, std::unique_ptr<method_wrapper
 
         auto m = create_item<::rttr::method>(meth.get());
         get_global_method_storage().insert(std::move(name), std::move(m));
+        get_global_method_cache().clear();
         get_method_storage().push_back(std::move(meth));
     }
 }
@@ -763,8 +860,19 @@ method type_register_private::get_type_method(const type& t, string_view name,
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_register_private::update_class_list(const type& t)
+{
+    get_pending_class_list().push_back(t);
+
+    // inside a batch, the list will be built once, when the batch ends
+    if (get_batch_depth() == 0)
+        update_pending_class_lists();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T>
-void type_register_private::update_class_list(const type& t, T item_ptr)
+void type_register_private::build_class_list(const type& t, T item_ptr, hashed_name_index class_data::* index_ptr)
 {
     // update type "t" with all items from the base classes
     auto& all_class_items = (t.m_type_data->get_class_data().*item_ptr);
@@ -786,9 +894,264 @@ void type_register_private::update_class_list(const type& t, T item_ptr)
     all_class_items.reserve(all_class_items.size() + item_vec.size());
     all_class_items.insert(all_class_items.end(), item_vec.begin(), item_vec.end());
 
-    // update derived types
-    for (const auto& derived_type : t.get_derived_classes())
-        update_class_list<T>(derived_type, item_ptr);
+    (t.m_type_data->get_class_data().*index_ptr).rebuild(all_class_items);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int& type_register_private::get_batch_depth()
+{
+    static int depth = 0;
+    return depth;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<type>& type_register_private::get_pending_class_list()
+{
+    static std::vector<type> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::begin_batch()
+{
+    ++get_batch_depth();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::end_batch()
+{
+    auto& depth = get_batch_depth();
+    if (depth == 0 || --depth > 0)
+        return;
+
+    update_pending_class_lists();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::update_pending_class_lists()
+{
+    auto& pending_list = get_pending_class_list();
+    if (pending_list.empty())
+        return;
+
+    // collect the changed types and all of its derived types exactly once
+    std::vector<bool> visited(get_type_storage().size(), false);
+    std::vector<type> update_list;
+    std::vector<type> stack(pending_list.begin(), pending_list.end());
+    pending_list.clear();
+
+    while (!stack.empty())
+    {
+        const auto t = stack.back();
+        stack.pop_back();
+
+        if (visited[t.get_id()])
+            continue;
+
+        visited[t.get_id()] = true;
+        update_list.push_back(t);
+        for (const auto& derived_type : t.get_derived_classes())
+            stack.push_back(derived_type);
+    }
+
+    // every class list is built only from the declared items of its base classes,
+    // so the types can be updated in any order
+    for (const auto& t : update_list)
+    {
+        build_class_list(t, &class_data::m_properties, &class_data::m_property_index);
+        build_class_list(t, &class_data::m_methods, &class_data::m_method_index);
+        t.m_type_data->get_class_data().m_method_cache.clear();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool& type_register_private::get_sealed_flag()
+{
+    static bool sealed = false;
+    return sealed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool type_register_private::is_sealed()
+{
+    return get_sealed_flag();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+hashed_name_index& type_register_private::get_type_name_index()
+{
+    static hashed_name_index obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+hashed_name_index& type_register_private::get_global_property_index()
+{
+    static hashed_name_index obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+hashed_name_index& type_register_private::get_global_method_index()
+{
+    static hashed_name_index obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE void shrink_vector(std::vector<T>& vec)
+{
+    vec.shrink_to_fit();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Data_Type>
+void type_register_private::move_to_table(std::vector<data_container<T, Data_Type>>& vec, type_id_table<Data_Type>& table)
+{
+    // the list is already sorted by id
+    table.reserve(vec.size());
+    for (auto& item : vec)
+        table.push_back(item.m_id, std::move(item.m_data));
+
+    vec.clear();
+    vec.shrink_to_fit();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::seal()
+{
+    if (is_sealed())
+        return;
+
+    // items of a still running batch have to be committed first
+    update_pending_class_lists();
+    shrink_vector(get_pending_class_list());
+
+    for (const auto& t : get_type_storage())
+    {
+        auto& data = t.m_type_data->get_class_data();
+        shrink_vector(data.m_base_types);
+        shrink_vector(data.m_derived_types);
+        shrink_vector(data.m_conversion_list);
+        shrink_vector(data.m_offset_list);
+        shrink_vector(data.m_properties);
+        shrink_vector(data.m_methods);
+        shrink_vector(data.m_ctors);
+        shrink_vector(data.m_nested_types);
+        data.m_base_type_ids.shrink_to_fit();
+        data.m_derived_type_ids.shrink_to_fit();
+    }
+
+    shrink_vector(get_type_storage());
+    shrink_vector(get_type_data_storage());
+    shrink_vector(get_converter_storage());
+    for (auto& converter_list : get_converter_table())
+        shrink_vector(converter_list);
+    shrink_vector(get_converter_table());
+    move_to_table(get_type_comparator_list(), get_comparator_table());
+    move_to_table(get_type_equal_comparator_list(), get_equal_comparator_table());
+    move_to_table(get_type_less_comparator_list(), get_less_comparator_table());
+    move_to_table(get_enumeration_list(), get_enumeration_table());
+    move_to_table(get_metadata_type_list(), get_metadata_table());
+
+    // the type name index replaces the custom name map; the invalid type at index zero is skipped
+    auto& type_list = get_type_storage();
+    auto& type_name_index = get_type_name_index();
+    type_name_index.clear();
+    type_name_index.reserve(type_list.size());
+    for (std::uint32_t index = 1; index < type_list.size(); ++index)
+        type_name_index.insert(type_list, index);
+
+    get_custom_name_to_id().clear();
+    get_custom_name_to_id().shrink_to_fit();
+    get_orig_name_to_id().shrink_to_fit();
+    get_global_property_storage().shrink_to_fit();
+    get_global_method_storage().shrink_to_fit();
+
+    get_global_property_index().rebuild(get_global_property_storage().value_data());
+    get_global_method_index().rebuild(get_global_method_storage().value_data());
+
+    get_sealed_flag() = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE std::size_t get_vector_memory(const std::vector<T>& vec)
+{
+    return (vec.capacity() * sizeof(T));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t type_register_private::get_memory_usage()
+{
+    std::size_t result = 0;
+
+    for (const auto& t : get_type_storage())
+    {
+        const auto& data = t.m_type_data->get_class_data();
+        result += sizeof(class_data);
+        result += get_vector_memory(data.m_base_types);
+        result += get_vector_memory(data.m_derived_types);
+        result += get_vector_memory(data.m_conversion_list);
+        result += get_vector_memory(data.m_offset_list);
+        result += get_vector_memory(data.m_properties);
+        result += get_vector_memory(data.m_methods);
+        result += get_vector_memory(data.m_ctors);
+        result += get_vector_memory(data.m_nested_types);
+        result += data.m_property_index.get_memory_usage();
+        result += data.m_method_index.get_memory_usage();
+        result += data.m_base_type_ids.get_memory_usage();
+        result += data.m_derived_type_ids.get_memory_usage();
+        result += data.m_method_cache.get_memory_usage();
+        result += data.m_ctor_cache.get_memory_usage();
+    }
+
+    result += get_vector_memory(get_type_storage());
+    result += get_vector_memory(get_type_data_storage());
+    result += get_vector_memory(get_pending_class_list());
+    result += get_vector_memory(get_converter_storage());
+    result += get_vector_memory(get_converter_table());
+    for (const auto& converter_list : get_converter_table())
+        result += get_vector_memory(converter_list);
+    result += get_vector_memory(get_type_comparator_list());
+    result += get_vector_memory(get_type_equal_comparator_list());
+    result += get_vector_memory(get_type_less_comparator_list());
+    result += get_vector_memory(get_enumeration_list());
+    result += get_vector_memory(get_metadata_type_list());
+
+    result += get_comparator_table().get_memory_usage();
+    result += get_equal_comparator_table().get_memory_usage();
+    result += get_less_comparator_table().get_memory_usage();
+    result += get_enumeration_table().get_memory_usage();
+    result += get_metadata_table().get_memory_usage();
+
+    result += get_custom_name_to_id().get_memory_usage();
+    result += get_orig_name_to_id().get_memory_usage();
+    result += get_global_property_storage().get_memory_usage();
+    result += get_global_method_storage().get_memory_usage();
+    result += get_global_method_cache().get_memory_usage();
+
+    result += get_type_name_index().get_memory_usage();
+    result += get_global_property_index().get_memory_usage();
+    result += get_global_method_index().get_memory_usage();
+
+    return result;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -813,11 +1176,20 @@ RTTR_INLINE T* type_register_private::get_item_by_type(const type& t, const std:
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+RTTR_INLINE T* type_register_private::get_item_by_type(const type& t, const type_id_table<std::unique_ptr<T>>& table)
+{
+    const auto index = table.find(t.get_id());
+    return (index != table.npos ? table.get_item(index).get() : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T>
 RTTR_INLINE void type_register_private::register_item_type(const type& t, std::unique_ptr<T> new_item,
                                                            std::vector<data_container<T>>& vec)
 {
-    if (!t.is_valid())
+    if (!t.is_valid() || is_sealed())
         return;
 
     using data_type = data_container<T>;
@@ -829,6 +1201,9 @@ RTTR_INLINE void type_register_private::register_item_type(const type& t, std::u
 
 std::vector<metadata>* type_register_private::get_metadata_list(const type& t)
 {
+    if (is_sealed())
+        return get_item_by_type(t, get_metadata_table());
+
     return get_item_by_type(t, get_metadata_type_list());
 }
 
@@ -843,7 +1218,7 @@ void type_register_private::register_enumeration(const type& t, std::unique_ptr<
 
 void type_register_private::register_metadata( const type& t, std::vector<metadata> data)
 {
-    if (!t.is_valid() || data.empty())
+    if (!t.is_valid() || data.empty() || is_sealed())
         return;
 
     auto meta_vec = get_metadata_list(t);
@@ -871,23 +1246,30 @@ void type_register_private::register_metadata( const type& t, std::vector<metada
 
 void type_register_private::converter(const type& t, std::unique_ptr<type_converter_base> converter)
 {
-    if (!t.is_valid())
+    if (!t.is_valid() || is_sealed())
         return;
 
     if (get_converter(t, converter->m_target_type))
         return;
 
-    using vec_value_type = data_container<type_converter_base>;
-    auto& container = get_type_converter_list();
-    container.push_back({t.get_id(), std::move(converter)});
-    std::stable_sort(container.begin(), container.end(), vec_value_type::order_by_id());
+    auto& table = get_converter_table();
+    const auto src_id = t.get_id();
+    if (src_id >= table.size())
+        table.resize(src_id + 1);
+
+    auto& converter_list = table[src_id];
+    const auto target_id = converter->m_target_type.get_id();
+    auto itr = std::lower_bound(converter_list.begin(), converter_list.end(), target_id,
+                                [](const converter_entry& item, type::type_id id) { return item.m_target_id < id; });
+    converter_list.insert(itr, converter_entry{target_id, converter.get()});
+    get_converter_storage().push_back(std::move(converter));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 void type_register_private::comparator(const type& t, const type_comparator_base* comparator)
 {
-    if (!t.is_valid())
+    if (!t.is_valid() || is_sealed())
         return;
 
     using data_type = data_container<const type_comparator_base*>;
@@ -901,20 +1283,19 @@ void type_register_private::comparator(const type& t, const type_comparator_base
 
 const type_converter_base* type_register_private::get_converter(const type& source_type, const type& target_type)
 {
+    const auto& table = get_converter_table();
     const auto src_id = source_type.get_id();
+    if (src_id >= table.size())
+        return nullptr;
+
+    // a type has only a few converters, so a linear search is faster than a binary search
     const auto target_id = target_type.get_id();
-    using vec_value_type = data_container<type_converter_base>;
-    auto& container = get_type_converter_list();
-    auto itr = std::lower_bound(container.cbegin(), container.cend(),
-                                src_id, vec_value_type::order_by_id());
-    for (; itr != container.cend(); ++itr)
+    for (const auto& item : table[src_id])
     {
-        auto& item = *itr;
-        if (item.m_id != src_id)
-            break; // type not found
-
-        if (item.m_data->m_target_type.get_id() == target_id)
-            return item.m_data.get();
+        if (item.m_target_id == target_id)
+            return item.m_converter;
+        else if (item.m_target_id > target_id)
+            break;
     }
 
     return nullptr;
@@ -924,21 +1305,19 @@ const type_converter_base* type_register_private::get_converter(const type& sour
 
 const type_comparator_base* type_register_private::get_comparator(const type& t)
 {
-    using vec_value_type = data_container<const type_comparator_base*>;
-    const auto id = t.get_id();
-    auto& container = get_type_comparator_list();
-    auto itr = std::lower_bound(container.cbegin(), container.cend(), id,
-                                vec_value_type::order_by_id());
-    if (itr != container.cend() && itr->m_id == id)
-        return itr->m_data;
-    else
-        return nullptr;
+    if (is_sealed())
+        return get_type_comparator_impl(t, get_comparator_table());
+
+    return get_type_comparator_impl(t, get_type_comparator_list());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
 
 const type_comparator_base* type_register_private::get_equal_comparator(const type& t)
 {
+    if (is_sealed())
+        return get_type_comparator_impl(t, get_equal_comparator_table());
+
     return get_type_comparator_impl(t, get_type_equal_comparator_list());
 }
 
@@ -946,6 +1325,9 @@ const type_comparator_base* type_register_private::get_equal_comparator(const ty
 
 const type_comparator_base* type_register_private::get_less_than_comparator(const type& t)
 {
+    if (is_sealed())
+        return get_type_comparator_impl(t, get_less_comparator_table());
+
     return get_type_comparator_impl(t, get_type_less_comparator_list());
 }
 
@@ -967,6 +1349,16 @@ type_register_private::get_type_comparator_impl(const type& t,
 
 /////////////////////////////////////////////////////////////////////////////////////
 
+const type_comparator_base*
+type_register_private::get_type_comparator_impl(const type& t,
+                                                const type_id_table<const type_comparator_base*>& comparator_table)
+{
+    const auto index = comparator_table.find(t.get_id());
+    return (index != comparator_table.npos ? comparator_table.get_item(index) : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
 void type_register_private::equal_comparator(const type& t, const type_comparator_base* comparator)
 {
     register_comparator_impl(t, comparator, get_type_equal_comparator_list());
@@ -984,7 +1376,7 @@ void type_register_private::less_than_comparator(const type& t, const type_compa
 void type_register_private::register_comparator_impl(const type& t, const type_comparator_base* comparator,
                                                      std::vector<data_container<const type_comparator_base*>>& comparator_list)
 {
-    if (!t.is_valid())
+    if (!t.is_valid() || is_sealed())
         return;
 
     using data_type = data_container<const type_comparator_base*>;
@@ -1020,7 +1412,9 @@ variant type_register_private::get_metadata(const variant& key, const std::vecto
 
 enumeration type_register_private::get_enumeration(const type& t)
 {
-    if (auto item = get_item_by_type(t, get_enumeration_list()))
+    const auto item = (is_sealed() ? get_item_by_type(t, get_enumeration_table())
+                                   : get_item_by_type(t, get_enumeration_list()));
+    if (item)
         return create_item<enumeration>(item);
     else
         return create_invalid_item<enumeration>();
@@ -105,6 +105,20 @@ public:
 
     static void register_base_class(const type& derived_type, const base_class_info& base_info);
 
+    /*!
+     * \brief Starts a registration batch; the inherited property and method lists of the classes
+     *        will not be updated for every registered item anymore, only the affected types are remembered.
+     *
+     * \remark Every call has to be paired with a call to \ref end_batch().
+     */
+    static void begin_batch();
+
+    /*!
+     * \brief Ends a registration batch; when it was the outermost batch,
+     *        the inherited class item lists of all affected types are build in one pass.
+     */
+    static void end_batch();
+
     /*!
      * \brief Register the type info for the given name
      *
@@ -125,6 +139,23 @@ private:
     friend struct detail::type_getter;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Helper class to call \ref type_register::begin_batch() and \ref type_register::end_batch() in RAII style.
+ *
+ * It is used by the \ref RTTR_REGISTRATION macro, so all items of one registration block are committed at once.
+ */
+class registration_batch
+{
+public:
+    registration_batch() { type_register::begin_batch(); }
+    ~registration_batch() { type_register::end_batch(); }
+
+    registration_batch(const registration_batch&) = delete;
+    registration_batch& operator=(const registration_batch&) = delete;
+};
+
 } // end namespace detail
 } // end namespace rttr
 
@@ -31,6 +31,8 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/flat_multimap.h"
 #include "rttr/detail/misc/flat_map.h"
+#include "rttr/detail/misc/type_id_table.h"
+#include "rttr/detail/misc/overload_cache.h"
 #include "rttr/enumeration.h"
 #include "rttr/variant.h"
 #include "rttr/detail/metadata/metadata.h"
@@ -57,6 +59,8 @@ class method_wrapper_base;
 class enumeration_wrapper_base;
 
 struct type_data;
+struct class_data;
+class hashed_name_index;
 
 /*!
  * This class contains all logic to register properties, methods etc.. for a specific type.
@@ -74,9 +78,29 @@ public:
     static void method(const type& t, std::unique_ptr<method_wrapper_base> meth);
     static void register_custom_name(type& t, string_view custom_name);
 
+    static void begin_batch();
+    static void end_batch();
+
+    /*!
+     * Compacts all registration tables, moves the per type tables (comparators, enumerations and metadata)
+     * into sorted id tables and creates the hashed name tables for types, global properties and methods.
+     * Afterwards, every further registration of items will be ignored.
+     */
+    static void seal();
+    static bool is_sealed();
+    //! Returns the approximated amount of bytes, which are used by the registration tables
+    static std::size_t get_memory_usage();
+
+    //! The following name indices are only valid, when the registry is sealed
+    static hashed_name_index& get_type_name_index(); // index into 'get_type_storage()'
+    static hashed_name_index& get_global_property_index();
+    static hashed_name_index& get_global_method_index();
+
     /////////////////////////////////////////////////////////////////////////////////////
     static flat_multimap<string_view, ::rttr::property>& get_global_property_storage();
     static flat_multimap<string_view, ::rttr::method>& get_global_method_storage();
+    //! The global methods selected by type::invoke()
+    static overload_cache<::rttr::method>& get_global_method_cache();
     /////////////////////////////////////////////////////////////////////////////////////
 
     static std::vector<type_data*>& get_type_data_storage();
@@ -147,7 +171,15 @@ private:
     static std::vector<metadata>* get_metadata_list(const type& t);
     static variant get_metadata(const variant& key, const std::vector<metadata>& data);
 
-    static std::vector<data_container<type_converter_base>>& get_type_converter_list();
+    struct converter_entry
+    {
+        type::type_id               m_target_id;
+        const type_converter_base*  m_converter;
+    };
+
+    //! The index is the id of the source type; every list is sorted by the id of the target type
+    static std::vector<std::vector<converter_entry>>& get_converter_table();
+    static std::vector<std::unique_ptr<type_converter_base>>& get_converter_storage();
     static std::vector<data_container<const type_comparator_base*>>& get_type_comparator_list();
 
     static std::vector<data_container<const type_comparator_base*>>& get_type_equal_comparator_list();
@@ -156,18 +188,40 @@ private:
     static std::vector<data_container<enumeration_wrapper_base>>& get_enumeration_list();
     static std::vector<data_container<std::vector<metadata>>>& get_metadata_type_list();
 
+    //! The following tables replace the lists above, when the registry is sealed
+    static type_id_table<const type_comparator_base*>& get_comparator_table();
+    static type_id_table<const type_comparator_base*>& get_equal_comparator_table();
+    static type_id_table<const type_comparator_base*>& get_less_comparator_table();
+    static type_id_table<std::unique_ptr<enumeration_wrapper_base>>& get_enumeration_table();
+    static type_id_table<std::unique_ptr<std::vector<metadata>>>& get_metadata_table();
+
+    template<typename T, typename Data_Type>
+    static void move_to_table(std::vector<data_container<T, Data_Type>>& vec, type_id_table<Data_Type>& table);
+    template<typename T>
+    static RTTR_INLINE T* get_item_by_type(const type& t, const type_id_table<std::unique_ptr<T>>& table);
+
     static void register_comparator_impl(const type& t, const type_comparator_base* comparator,
                                          std::vector<data_container<const type_comparator_base*>>& comparator_list);
     static const type_comparator_base* get_type_comparator_impl(const type& t,
                                                                 const std::vector<data_container<const type_comparator_base*>>& comparator_list);
+    static const type_comparator_base* get_type_comparator_impl(const type& t,
+                                                                const type_id_table<const type_comparator_base*>& comparator_table);
 
     static ::rttr::property get_type_property(const type& t, string_view name);
     static ::rttr::method get_type_method(const type& t, string_view name);
     static ::rttr::method get_type_method(const type& t, string_view name,
                                           const std::vector<type>& type_list);
 
+    //! Updates the class item lists of type \p t and all its derived types with the items of their base classes
+    static void update_class_list(const type& t);
     template<typename T>
-    static void update_class_list(const type& t, T item_ptr);
+    static void build_class_list(const type& t, T item_ptr, hashed_name_index class_data::* index_ptr);
+
+    static int& get_batch_depth();
+    static bool& get_sealed_flag();
+    static std::vector<type>& get_pending_class_list();
+    //! Builds the class item lists of all types, which were changed during the batch, and of their derived types
+    static void update_pending_class_lists();
 
     static std::string derive_name(const type& t);
     //! Returns true, when the name was already registered
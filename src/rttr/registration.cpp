@@ -27,6 +27,8 @@
 
 #include "rttr/registration.h"
 
+#include "rttr/detail/type/type_register_p.h"
+
 namespace rttr
 {
 
@@ -36,4 +38,27 @@ const detail::protected_access registration::protected_access = {};
 
 const detail::private_access registration::private_access = {};
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registration::seal()
+{
+    detail::type_register_private::seal();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registration::is_sealed()
+{
+    return detail::type_register_private::is_sealed();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t registration::get_memory_usage()
+{
+    return detail::type_register_private::get_memory_usage();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
@@ -356,6 +356,36 @@ public:
     template<typename Enum_Type>
     static bind<detail::enum_, void, Enum_Type> enumeration(string_view name);
 
+    /*!
+     * \brief Freezes the registered reflection information.
+     *
+     * All internal registration tables will be compacted; the comparators, enumerations and metadata
+     * are moved into tables sorted by type id and the names of all types, global properties
+     * and global methods are stored in hashed lookup tables.
+     * Call this function once, when all reflection information was registered, e.g. at the beginning of `main`.
+     *
+     * \remark After sealing, every further registration of classes, properties, methods, constructors,
+     *         enumerations, metadata, converters or comparators will be ignored. Types which are used the first time afterwards,
+     *         will still be registered automatically.
+     *
+     * \see is_sealed(), get_memory_usage()
+     */
+    static void seal();
+
+    /*!
+     * \brief Returns true, when the registered reflection information was frozen with \ref seal(), otherwise false.
+     */
+    static bool is_sealed();
+
+    /*!
+     * \brief Returns the approximated amount of memory in bytes, which is used by the internal registration tables.
+     *
+     * The memory of the registered property, method and constructor objects itself is not included.
+     *
+     * \see seal()
+     */
+    static std::size_t get_memory_usage();
+
     /////////////////////////////////////////////////////////////////////////////////////
 
     /*!
@@ -713,6 +743,8 @@ RTTR_INLINE detail::parameter_names<detail::decay_t<TArgs>...> parameter_names(T
  * Just place the macro in global scope in a cpp file.
  *
  * \remark It is not possible to place the macro multiple times in one cpp file.
+ *          All items of one registration block are committed at once; the inherited properties and methods
+ *          of a derived class are therefore only available after the block has been executed completely.
  *
  */
 #define RTTR_REGISTRATION
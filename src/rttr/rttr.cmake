@@ -109,10 +109,13 @@ set(HEADER_FILES access_levels.h
                  detail/misc/flat_map.h
                  detail/misc/flat_multimap.h
                  detail/misc/function_traits.h
+                 detail/misc/hashed_name_index.h
                  detail/misc/iterator_wrapper.h
                  detail/misc/misc_type_traits.h
                  detail/misc/sequential_container_type_traits.h
                  detail/misc/std_type_traits.h
+                 detail/misc/type_id_set.h
+                 detail/misc/type_id_table.h
                  detail/misc/template_type_trait.h
                  detail/misc/template_type_trait_impl.h
                  detail/misc/utility.h
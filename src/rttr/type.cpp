@@ -72,6 +72,25 @@ static array_range<T> get_items_for_type(const type& t,
                           detail::default_predicate<T>([t](const T& item) { return (item.get_declaring_type() == t); }) );
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns an iterator to the first global method with the given \p name;
+ * all overloads with the same name are stored consecutively.
+ */
+static detail::flat_multimap<string_view, method>::const_iterator
+find_global_method(const detail::flat_multimap<string_view, method>& meth_list, string_view name)
+{
+    if (detail::type_register_private::is_sealed())
+    {
+        auto& vec = meth_list.value_data();
+        const auto index = detail::type_register_private::get_global_method_index().find(name, vec.data());
+        return (index != detail::hashed_name_index::npos ? vec.cbegin() + index : meth_list.cend());
+    }
+
+    return meth_list.find(name);
+}
+
 } // end anonymous namespace
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -86,15 +105,7 @@ bool type::is_derived_from(const type& other) const RTTR_NOEXCEPT
     if (src_raw_type == tgt_raw_type)
         return true;
 
-    for (auto& t : src_raw_type->get_class_data().m_base_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return src_raw_type->get_class_data().m_base_type_ids.contains(tgt_raw_type->type_index);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -107,15 +118,7 @@ bool type::is_base_of(const type& other) const RTTR_NOEXCEPT
     if (src_raw_type == tgt_raw_type)
         return true;
 
-    for (auto& t : src_raw_type->get_class_data().m_derived_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return src_raw_type->get_class_data().m_derived_type_ids.contains(tgt_raw_type->type_index);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -133,17 +136,16 @@ void* type::apply_offset(void* ptr, const type& source_type, const type& target_
         return info.m_ptr;
 
     auto& class_list = info.m_type.m_type_data->raw_type_data->get_class_data();
-    int i = 0;
-    for (auto& t : class_list.m_base_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return class_list.m_conversion_list[i](info.m_ptr);
-        }
-        ++i;
-    }
+    const auto index = class_list.m_base_type_ids.rank(tgt_raw_type->type_index);
+    if (index == detail::type_id_set::npos)
+        return nullptr;
+
+    // non-virtual inheritance; the pointer adjustment is a constant
+    const auto offset = class_list.m_offset_list[index];
+    if (offset != detail::no_static_offset)
+        return static_cast<char*>(info.m_ptr) + offset;
 
-    return nullptr;
+    return class_list.m_conversion_list[index](info.m_ptr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -201,14 +203,23 @@ variant type::get_metadata(const variant& key) const
 
 variant type::create(vector<argument> args) const
 {
-    auto& ctors = m_type_data->get_class_data().m_ctors;
-    for (const auto& ctor : ctors)
+    auto& class_data = m_type_data->get_class_data();
+    auto ctor = detail::create_invalid_item<constructor>();
+    if (!class_data.m_ctor_cache.find(string_view(), args, ctor))
     {
-        if (detail::compare_with_arg_list::compare(ctor.get_parameter_infos(), args))
-            return ctor.invoke_variadic(std::move(args));
+        for (const auto& item : class_data.m_ctors)
+        {
+            if (detail::compare_with_arg_list::compare(item.get_parameter_infos(), args))
+            {
+                ctor = item;
+                break;
+            }
+        }
+
+        class_data.m_ctor_cache.insert(string_view(), args, ctor);
     }
 
-    return variant();
+    return (ctor.is_valid() ? ctor.invoke_variadic(std::move(args)) : variant());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -222,14 +233,10 @@ bool type::destroy(variant& obj) const RTTR_NOEXCEPT
 
 property type::get_property(string_view name) const RTTR_NOEXCEPT
 {
-    const auto& vec = get_raw_type().m_type_data->get_class_data().m_properties;
-    auto ret = std::find_if(vec.cbegin(), vec.cend(),
-                            [name](const property& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.cend())
-        return *ret;
+    const auto& class_data = get_raw_type().m_type_data->get_class_data();
+    const auto index = class_data.m_property_index.find(name, class_data.m_properties.data());
+    if (index != detail::hashed_name_index::npos)
+        return class_data.m_properties[index];
 
     return detail::create_invalid_item<property>();
 }
@@ -298,15 +305,10 @@ array_range<property> type::get_properties(filter_items filter) const RTTR_NOEXC
 
 method type::get_method(string_view name) const RTTR_NOEXCEPT
 {
-    const auto raw_t = get_raw_type();
-    const auto& vec = raw_t.m_type_data->get_class_data().m_methods;
-    auto ret = std::find_if(vec.cbegin(), vec.cend(),
-                            [name](const method& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.cend())
-        return *ret;
+    const auto& class_data = get_raw_type().m_type_data->get_class_data();
+    const auto index = class_data.m_method_index.find(name, class_data.m_methods.data());
+    if (index != detail::hashed_name_index::npos)
+        return class_data.m_methods[index];
 
     return detail::create_invalid_item<method>();
 }
@@ -363,6 +365,13 @@ array_range<method> type::get_methods(filter_items filter) const RTTR_NOEXCEPT
 property type::get_global_property(string_view name) RTTR_NOEXCEPT
 {
     auto& prop_list = detail::type_register_private::get_global_property_storage();
+    if (detail::type_register_private::is_sealed())
+    {
+        auto& vec = prop_list.value_data();
+        const auto index = detail::type_register_private::get_global_property_index().find(name, vec.data());
+        return (index != detail::hashed_name_index::npos ? vec[index] : detail::create_invalid_item<property>());
+    }
+
     const auto ret = prop_list.find(name);
     if (ret != prop_list.end())
         return *ret;
@@ -375,7 +384,7 @@ property type::get_global_property(string_view name) RTTR_NOEXCEPT
 method type::get_global_method(string_view name) RTTR_NOEXCEPT
 {
     auto& meth_list = detail::type_register_private::get_global_method_storage();
-    const auto ret = meth_list.find(name);
+    const auto ret = find_global_method(meth_list, name);
     if (ret != meth_list.end())
         return *ret;
 
@@ -387,7 +396,7 @@ method type::get_global_method(string_view name) RTTR_NOEXCEPT
 method type::get_global_method(string_view name, const std::vector<type>& type_list) RTTR_NOEXCEPT
 {
     auto& meth_list = detail::type_register_private::get_global_method_storage();
-    auto itr = meth_list.find(name);
+    auto itr = find_global_method(meth_list, name);
     while (itr != meth_list.end())
     {
         const auto& meth = *itr;
@@ -431,45 +440,65 @@ enumeration type::get_enumeration() const RTTR_NOEXCEPT
 variant type::invoke(string_view name, instance obj, std::vector<argument> args) const
 {
     const auto raw_t = get_raw_type();
-    for (const auto& meth : raw_t.m_type_data->get_class_data().m_methods)
+    auto& class_data = raw_t.m_type_data->get_class_data();
+    auto meth = detail::create_invalid_item<method>();
+    if (!class_data.m_method_cache.find(name, args, meth))
     {
-        if ( meth.get_name() == name &&
-             detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
+        for (const auto& item : class_data.m_methods)
         {
-            return meth.invoke_variadic(obj, args);
+            if ( item.get_name() == name &&
+                 detail::compare_with_arg_list::compare(item.get_parameter_infos(), args))
+            {
+                meth = item;
+                break;
+            }
         }
+
+        class_data.m_method_cache.insert(name, args, meth);
     }
 
-    return variant();
+    return (meth.is_valid() ? meth.invoke_variadic(obj, args) : variant());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant type::invoke(string_view name, std::vector<argument> args)
 {
-    auto& meth_list = detail::type_register_private::get_global_method_storage();
-    auto itr = meth_list.find(name);
-    while (itr != meth_list.end())
+    auto& cache = detail::type_register_private::get_global_method_cache();
+    auto meth = detail::create_invalid_item<method>();
+    if (!cache.find(name, args, meth))
     {
-        const auto& meth = *itr;
-        if (meth.get_name() != name)
-            break;
-
-        if (detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
+        auto& meth_list = detail::type_register_private::get_global_method_storage();
+        for (auto itr = find_global_method(meth_list, name); itr != meth_list.end(); ++itr)
         {
-            return meth.invoke_variadic(instance(), args);
+            const auto& item = *itr;
+            if (item.get_name() != name)
+                break;
+
+            if (detail::compare_with_arg_list::compare(item.get_parameter_infos(), args))
+            {
+                meth = item;
+                break;
+            }
         }
 
-        ++itr;
+        cache.insert(name, args, meth);
     }
 
-    return variant();
+    return (meth.is_valid() ? meth.invoke_variadic(instance(), args) : variant());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 type type::get_by_name(string_view name) RTTR_NOEXCEPT
 {
+    if (detail::type_register_private::is_sealed())
+    {
+        auto& vec = detail::type_register_private::get_type_storage();
+        const auto index = detail::type_register_private::get_type_name_index().find(name, vec.data());
+        return (index != detail::hashed_name_index::npos ? vec[index] : detail::get_invalid_type());
+    }
+
     auto& custom_name_to_id = detail::type_register_private::get_custom_name_to_id();
     auto ret = custom_name_to_id.find(name);
     if (ret != custom_name_to_id.end())
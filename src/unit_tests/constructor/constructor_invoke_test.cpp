@@ -88,6 +88,12 @@ private:
     ctor_func_invoke_arg_test() {}
 };
 
+struct ctor_invoke_cache_test
+{
+    ctor_invoke_cache_test(int value = 0) : m_value(value) {}
+    int m_value;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 RTTR_REGISTRATION
@@ -158,6 +164,9 @@ RTTR_REGISTRATION
         .constructor(select_overload<ctor_func_invoke_arg_test(int, int, int, int, int, int, int)>(&ctor_func_invoke_arg_test::create))
         ;
 #endif
+
+    registration::class_<ctor_invoke_cache_test>("ctor_invoke_cache_test")
+        .constructor<>();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -379,3 +388,25 @@ TEST_CASE("constructor - invoke negative", "[constructor]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("constructor - invoke - cached overload resolution", "[constructor]")
+{
+    const type t = type::get<ctor_invoke_cache_test>();
+    CHECK(t.create().is_type<std::shared_ptr<ctor_invoke_cache_test>>() == true);
+    CHECK(t.create().is_type<std::shared_ptr<ctor_invoke_cache_test>>() == true);
+
+    // negative results are cached too
+    CHECK(t.create({23}).is_valid() == false);
+    CHECK(t.create({23}).is_valid() == false);
+
+    // a new constructor invalidates the cache
+    registration::class_<ctor_invoke_cache_test>("ctor_invoke_cache_test")
+        .constructor<int>();
+
+    variant var = t.create({23});
+    REQUIRE(var.is_type<std::shared_ptr<ctor_invoke_cache_test>>() == true);
+    CHECK(var.get_value<std::shared_ptr<ctor_invoke_cache_test>>()->m_value == 23);
+    CHECK(t.create({23.0}).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
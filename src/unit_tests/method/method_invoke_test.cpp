@@ -47,6 +47,22 @@ struct method_invoke_test
     std::array<bool, 8> m_invoked;
 };
 
+struct method_invoke_cache_base
+{
+    virtual ~method_invoke_cache_base() {}
+    int get_value() const { return 1; }
+    int add(int a, int b) const { return (a + b); }
+
+    RTTR_ENABLE()
+};
+
+struct method_invoke_cache_derived : method_invoke_cache_base
+{
+    RTTR_ENABLE(method_invoke_cache_base)
+};
+
+static int method_invoke_cache_global(int value) { return value; }
+
 
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -65,6 +81,11 @@ RTTR_REGISTRATION
         .method("func_8", std::function<int(int)>([](int value){ return value; }))
         .method("func_9", [](int value){ return value; })
         ;
+
+    registration::class_<method_invoke_cache_base>("method_invoke_cache_base")
+        .method("get_value", &method_invoke_cache_base::get_value);
+
+    registration::class_<method_invoke_cache_derived>("method_invoke_cache_derived");
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -192,3 +213,35 @@ TEST_CASE("method - invoke - lambda", "[method]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - invoke - cached overload resolution", "[method]")
+{
+    method_invoke_cache_derived obj;
+    const type t_base = type::get<method_invoke_cache_base>();
+    const type t_derived = type::get<method_invoke_cache_derived>();
+
+    // the second call is answered by the cache
+    CHECK(t_base.invoke("get_value", obj, {}).to_int() == 1);
+    CHECK(t_base.invoke("get_value", obj, {}).to_int() == 1);
+    CHECK(t_derived.invoke("get_value", obj, {}).to_int() == 1);
+
+    // negative results are cached too
+    CHECK(t_base.invoke("add", obj, {1, 2}).is_valid() == false);
+    CHECK(t_derived.invoke("add", obj, {1, 2}).is_valid() == false);
+    CHECK(type::invoke("method_invoke_cache_global", {1}).is_valid() == false);
+
+    // a new registration invalidates the cache of the class and of its derived classes
+    registration::class_<method_invoke_cache_base>("method_invoke_cache_base")
+        .method("add", &method_invoke_cache_base::add);
+    registration::method("method_invoke_cache_global", &method_invoke_cache_global);
+
+    CHECK(t_base.invoke("add", obj, {1, 2}).to_int() == 3);
+    CHECK(t_derived.invoke("add", obj, {1, 2}).to_int() == 3);
+    CHECK(type::invoke("method_invoke_cache_global", {1}).to_int() == 1);
+
+    // the argument types are part of the cache key
+    CHECK(t_derived.invoke("add", obj, {1.0, 2.0}).is_valid() == false);
+    CHECK(type::invoke("method_invoke_cache_global", {1.0}).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,9 @@
 #include <rttr/registration>
 #include <catch/catch.hpp>
 
+#include <string>
+#include <vector>
+
 using namespace rttr;
 using namespace std;
 
@@ -56,6 +59,53 @@ struct method_query_test_derived : method_query_test_base
 
 
 
+struct method_query_shadow_base
+{
+    int func() { return 1; }
+
+    RTTR_ENABLE()
+};
+
+struct method_query_shadow_derived : method_query_shadow_base
+{
+    int other_func() { return 2; }
+
+    RTTR_ENABLE(method_query_shadow_base)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct method_query_many_base
+{
+    int base_func() { return 1; }
+
+    RTTR_ENABLE()
+};
+
+struct method_query_many_derived : method_query_many_base
+{
+    int derived_func() { return 2; }
+
+    RTTR_ENABLE(method_query_many_base)
+};
+
+static const std::size_t g_many_meths_count = 64;
+
+// the registered names are not copied, so they have to outlive the registration
+static const std::vector<std::string>& get_many_meths_names(const std::string& prefix)
+{
+    static std::vector<std::string> base_names;
+    static std::vector<std::string> derived_names;
+    auto& names = (prefix == "base_" ? base_names : derived_names);
+    if (names.empty())
+    {
+        for (std::size_t i = 0; i < g_many_meths_count; ++i)
+            names.push_back(prefix + std::to_string(i));
+    }
+
+    return names;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 RTTR_REGISTRATION
@@ -75,6 +125,23 @@ RTTR_REGISTRATION
         .method("derived-static", &method_query_test_derived::func_4)
         .method("derived-static-protected", &method_query_test_derived::func_4, registration::protected_access)
         ;
+
+    registration::class_<method_query_shadow_base>("method_query_shadow_base")
+        .method("func", &method_query_shadow_base::func);
+
+    registration::class_<method_query_shadow_derived>("method_query_shadow_derived")
+        .method("func", &method_query_shadow_derived::other_func);
+
+    {
+        registration::class_<method_query_many_base> reg("method_query_many_base");
+        for (const auto& name : get_many_meths_names("base_"))
+            reg.method(name, &method_query_many_base::base_func);
+    }
+    {
+        registration::class_<method_query_many_derived> reg("method_query_many_derived");
+        for (const auto& name : get_many_meths_names("derived_"))
+            reg.method(name, &method_query_many_derived::derived_func);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -315,3 +382,51 @@ TEST_CASE("method - get_methods(filter_items)", "[method]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - get_method() - same name in base and derived class", "[method]")
+{
+    type t_derived = type::get<method_query_shadow_derived>();
+    REQUIRE(t_derived.get_methods().size() == 2);
+
+    // the method of the base class is registered first, so it is found first
+    method meth = t_derived.get_method("func");
+    REQUIRE(meth.is_valid() == true);
+    CHECK(meth.get_declaring_type() == type::get<method_query_shadow_base>());
+
+    method_query_shadow_derived obj;
+    CHECK(meth.invoke(obj) == 1);
+    CHECK(t_derived.invoke("func", obj, {}) == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - get_method() - class with many inherited methods", "[method]")
+{
+    type t_derived = type::get<method_query_many_derived>();
+    REQUIRE(t_derived.get_methods().size() == 2 * g_many_meths_count);
+
+    method_query_many_derived obj;
+    for (const auto& name : get_many_meths_names("base_"))
+    {
+        method meth = t_derived.get_method(name);
+        REQUIRE(meth.is_valid() == true);
+        CHECK(meth.get_name() == name);
+        CHECK(meth.get_declaring_type() == type::get<method_query_many_base>());
+        CHECK(meth.invoke(obj) == 1);
+    }
+
+    for (const auto& name : get_many_meths_names("derived_"))
+    {
+        method meth = t_derived.get_method(name);
+        REQUIRE(meth.is_valid() == true);
+        CHECK(meth.get_name() == name);
+        CHECK(meth.get_declaring_type() == t_derived);
+        CHECK(meth.invoke(obj) == 2);
+    }
+
+    CHECK(t_derived.get_method("base_").is_valid() == false);
+    CHECK(t_derived.get_method("derived_64").is_valid() == false);
+    CHECK(type::get<method_query_many_base>().get_method("derived_0").is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
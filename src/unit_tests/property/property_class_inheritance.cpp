@@ -30,6 +30,8 @@
 #include <iostream>
 #include <memory>
 #include <functional>
+#include <string>
+#include <vector>
 
 #include <catch/catch.hpp>
 
@@ -125,6 +127,71 @@ struct derived_class_without_registered_props : base_class_with_props
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+struct batch_base_class
+{
+    int base_value = 1;
+
+    RTTR_ENABLE()
+};
+
+struct batch_derived_class : batch_base_class
+{
+    int derived_value = 2;
+
+    RTTR_ENABLE(batch_base_class)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct shadow_base_class
+{
+    int value = 1;
+
+    RTTR_ENABLE()
+};
+
+struct shadow_derived_class : shadow_base_class
+{
+    int other_value = 2;
+
+    RTTR_ENABLE(shadow_base_class)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct many_props_base_class
+{
+    int base_value = 1;
+
+    RTTR_ENABLE()
+};
+
+struct many_props_derived_class : many_props_base_class
+{
+    int derived_value = 2;
+
+    RTTR_ENABLE(many_props_base_class)
+};
+
+static const std::size_t g_many_props_count = 64;
+
+// the registered names are not copied, so they have to outlive the registration
+static const std::vector<std::string>& get_many_props_names(const std::string& prefix)
+{
+    static std::vector<std::string> base_names;
+    static std::vector<std::string> derived_names;
+    auto& names = (prefix == "base_" ? base_names : derived_names);
+    if (names.empty())
+    {
+        for (std::size_t i = 0; i < g_many_props_count; ++i)
+            names.push_back(prefix + std::to_string(i));
+    }
+
+    return names;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 static double g_name;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +251,23 @@ RTTR_REGISTRATION
         .property("value", &base_class_with_props::value);
 
     registration::class_<derived_class_without_registered_props>("derived_class_without_registered_props");
+
+    registration::class_<shadow_base_class>("shadow_base_class")
+        .property("value", &shadow_base_class::value);
+
+    registration::class_<shadow_derived_class>("shadow_derived_class")
+        .property("value", &shadow_derived_class::other_value);
+
+    {
+        registration::class_<many_props_base_class> reg("many_props_base_class");
+        for (const auto& name : get_many_props_names("base_"))
+            reg.property(name, &many_props_base_class::base_value);
+    }
+    {
+        registration::class_<many_props_derived_class> reg("many_props_derived_class");
+        for (const auto& name : get_many_props_names("derived_"))
+            reg.property(name, &many_props_derived_class::derived_value);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -549,3 +633,84 @@ TEST_CASE("property - check inheritance of probs", "[property]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - inheritance with registration batch", "[property]")
+{
+    type t_derived = type::get<batch_derived_class>(); // base and derived type are already known
+
+    {
+        detail::registration_batch batch;
+        registration::class_<batch_base_class>("batch_base_class")
+            .property("base_value", &batch_base_class::base_value);
+
+        registration::class_<batch_derived_class>("batch_derived_class")
+            .property("derived_value", &batch_derived_class::derived_value);
+
+        // the inherited items will be added, when the batch ends
+        CHECK(t_derived.get_properties().size() == 1);
+        CHECK(t_derived.get_property("base_value").is_valid() == false);
+    }
+
+    auto prop_range = t_derived.get_properties();
+    REQUIRE(prop_range.size() == 2);
+
+    std::vector<property> props(prop_range.begin(), prop_range.end());
+    CHECK(props[0].get_name() == "base_value");
+    CHECK(props[1].get_name() == "derived_value");
+
+    batch_derived_class obj;
+    CHECK(t_derived.get_property("base_value").get_value(obj) == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_property() - same name in base and derived class", "[property]")
+{
+    type t_derived = type::get<shadow_derived_class>();
+    REQUIRE(t_derived.get_properties().size() == 2);
+
+    // the property of the base class is registered first, so it is found first
+    property prop = t_derived.get_property("value");
+    REQUIRE(prop.is_valid() == true);
+    CHECK(prop.get_declaring_type() == type::get<shadow_base_class>());
+
+    shadow_derived_class obj;
+    CHECK(prop.get_value(obj) == 1);
+
+    auto declared_range = t_derived.get_properties(filter_item::instance_item | filter_item::public_access | filter_item::declared_only);
+    REQUIRE(declared_range.size() == 1);
+    CHECK((*declared_range.begin()).get_declaring_type() == t_derived);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_property() - class with many inherited properties", "[property]")
+{
+    type t_derived = type::get<many_props_derived_class>();
+    REQUIRE(t_derived.get_properties().size() == 2 * g_many_props_count);
+
+    many_props_derived_class obj;
+    for (const auto& name : get_many_props_names("base_"))
+    {
+        property prop = t_derived.get_property(name);
+        REQUIRE(prop.is_valid() == true);
+        CHECK(prop.get_name() == name);
+        CHECK(prop.get_declaring_type() == type::get<many_props_base_class>());
+        CHECK(prop.get_value(obj) == 1);
+    }
+
+    for (const auto& name : get_many_props_names("derived_"))
+    {
+        property prop = t_derived.get_property(name);
+        REQUIRE(prop.is_valid() == true);
+        CHECK(prop.get_name() == name);
+        CHECK(prop.get_declaring_type() == t_derived);
+        CHECK(prop.get_value(obj) == 2);
+    }
+
+    CHECK(t_derived.get_property("base_").is_valid() == false);
+    CHECK(t_derived.get_property("derived_64").is_valid() == false);
+    CHECK(type::get<many_props_base_class>().get_property("derived_0").is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
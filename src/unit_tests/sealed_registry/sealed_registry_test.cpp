@@ -0,0 +1,280 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct sealed_test_class
+{
+    int get_value() const { return value; }
+    int value = 42;
+    int other_value = 23;
+};
+
+enum class sealed_color
+{
+    red,
+    green
+};
+
+struct sealed_cmp_class
+{
+    bool operator==(const sealed_cmp_class& other) const { return (value == other.value); }
+    int value;
+};
+
+template<typename T>
+struct sealed_late_type {};
+
+// the nesting creates a distinct type name for every index
+template<std::size_t Index>
+struct sealed_late_type_at
+{
+    using type = sealed_late_type<typename sealed_late_type_at<Index - 1>::type>;
+};
+
+template<>
+struct sealed_late_type_at<0>
+{
+    using type = sealed_late_type<void>;
+};
+
+static int g_sealed_value = 12;
+
+static int sealed_add(int a, int b) { return (a + b); }
+static double sealed_add(double a, double b) { return (a + b); }
+static int sealed_sub(int a, int b) { return (a - b); }
+
+static std::string convert_to_string(const sealed_test_class& obj, bool& ok)
+{
+    ok = true;
+    return std::to_string(obj.value);
+}
+
+static int convert_to_int(const sealed_test_class& obj, bool& ok)
+{
+    ok = true;
+    return obj.value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::size_t g_memory_before_seal = 0;
+
+static void seal_registry()
+{
+    if (registration::is_sealed())
+        return;
+
+    g_memory_before_seal = registration::get_memory_usage();
+    registration::seal();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t... Indices>
+static std::vector<type> get_late_types(detail::index_sequence<Indices...>)
+{
+    return {type::get<typename sealed_late_type_at<Indices>::type>()...};
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<sealed_test_class>("sealed_test_class")
+        (
+            metadata("key", "sealed")
+        )
+        .property("value", &sealed_test_class::value)
+        .method("get_value", &sealed_test_class::get_value);
+
+    registration::enumeration<sealed_color>("sealed_color")
+        (
+            value("red",    sealed_color::red),
+            value("green",  sealed_color::green)
+        );
+
+    registration::property("sealed_global_value", &g_sealed_value)
+        .method("sealed_add", select_overload<int(int, int)>(&sealed_add))
+        .method("sealed_add", select_overload<double(double, double)>(&sealed_add));
+
+    type::register_converter_func(convert_to_string);
+    type::register_equal_comparator<sealed_cmp_class>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration - seal()", "[sealed_registry]")
+{
+    CHECK(type::get_by_name("sealed_test_class").is_valid() == true);
+
+    seal_registry();
+
+    CHECK(registration::is_sealed() == true);
+    CHECK(registration::get_memory_usage() > 0);
+    CHECK(registration::get_memory_usage() <= g_memory_before_seal);
+
+    const auto memory = registration::get_memory_usage();
+    registration::seal();
+    CHECK(registration::get_memory_usage() == memory);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration - sealed type::get_by_name()", "[sealed_registry]")
+{
+    seal_registry();
+
+    CHECK(type::get_by_name("sealed_test_class") == type::get<sealed_test_class>());
+    CHECK(type::get_by_name("sealed_color") == type::get<sealed_color>());
+    CHECK(type::get_by_name("int") == type::get<int>());
+    CHECK(type::get_by_name("std::string") == type::get<std::string>());
+    CHECK(type::get_by_name("sealed_test_class*") == type::get<sealed_test_class*>());
+
+    CHECK(type::get_by_name("").is_valid() == false);
+    CHECK(type::get_by_name("sealed_unknown_class").is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration - sealed global property and method lookup", "[sealed_registry]")
+{
+    seal_registry();
+
+    property prop = type::get_global_property("sealed_global_value");
+    REQUIRE(prop.is_valid() == true);
+    CHECK(prop.get_value(instance()).to_int() == 12);
+    CHECK(type::get_global_property("sealed_unknown_value").is_valid() == false);
+
+    method meth = type::get_global_method("sealed_add");
+    REQUIRE(meth.is_valid() == true);
+    CHECK(meth.get_name() == "sealed_add");
+
+    meth = type::get_global_method("sealed_add", {type::get<double>(), type::get<double>()});
+    REQUIRE(meth.is_valid() == true);
+    CHECK(meth.get_return_type() == type::get<double>());
+
+    meth = type::get_global_method("sealed_add", {type::get<int>(), type::get<int>()});
+    REQUIRE(meth.is_valid() == true);
+    CHECK(meth.get_return_type() == type::get<int>());
+
+    CHECK(type::get_global_method("sealed_add", {type::get<float>(), type::get<int>()}).is_valid() == false);
+    CHECK(type::get_global_method("sealed_unknown_method").is_valid() == false);
+
+    variant ret = type::invoke("sealed_add", {1, 2});
+    REQUIRE(ret.is_type<int>() == true);
+    CHECK(ret.get_value<int>() == 3);
+
+    ret = type::invoke("sealed_add", {1.5, 2.0});
+    REQUIRE(ret.is_type<double>() == true);
+    CHECK(ret.get_value<double>() == 3.5);
+
+    CHECK(type::invoke("sealed_unknown_method", {1, 2}).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration - sealed class items and per type tables", "[sealed_registry]")
+{
+    seal_registry();
+
+    const auto t = type::get<sealed_test_class>();
+    sealed_test_class obj;
+    CHECK(t.get_property_value("value", obj).to_int() == 42);
+    CHECK(t.invoke("get_value", obj, {}).to_int() == 42);
+    CHECK(t.get_metadata("key").to_string() == "sealed");
+    CHECK(t.get_metadata("unknown_key").is_valid() == false);
+
+    enumeration e = type::get<sealed_color>().get_enumeration();
+    REQUIRE(e.is_valid() == true);
+    CHECK(e.value_to_name(sealed_color::green) == "green");
+
+    variant var = obj;
+    CHECK(var.can_convert<std::string>() == true);
+    CHECK(var.to_string() == "42");
+
+    variant a = sealed_cmp_class{1};
+    variant b = sealed_cmp_class{1};
+    CHECK((a == b) == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration - types created after seal()", "[sealed_registry]")
+{
+    seal_registry();
+
+    // enough types to let the type name index grow a few times
+    const auto late_types = get_late_types(detail::make_index_sequence<100>());
+    for (const auto& t : late_types)
+    {
+        REQUIRE(t.is_valid() == true);
+        CHECK(type::get_by_name(t.get_name()) == t);
+    }
+
+    const auto t = type::get<sealed_late_type<int>*>();
+    CHECK(type::get_by_name(t.get_name()) == t);
+
+    // the types registered before sealing are still found
+    CHECK(type::get_by_name("sealed_test_class") == type::get<sealed_test_class>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration - registrations are ignored after seal()", "[sealed_registry]")
+{
+    seal_registry();
+
+    registration::class_<sealed_test_class>("sealed_test_class")
+        .property("other_value", &sealed_test_class::other_value);
+    registration::property("sealed_late_value", &g_sealed_value)
+        .method("sealed_sub", &sealed_sub);
+    type::register_converter_func(convert_to_int);
+
+    const auto t = type::get<sealed_test_class>();
+    CHECK(t.get_property("value").is_valid() == true);
+    CHECK(t.get_property("other_value").is_valid() == false);
+    CHECK(type::get_global_property("sealed_late_value").is_valid() == false);
+    CHECK(type::get_global_method("sealed_sub").is_valid() == false);
+
+    variant var = sealed_test_class();
+    CHECK(var.can_convert<int>() == false);
+}
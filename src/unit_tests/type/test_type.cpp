@@ -241,6 +241,28 @@ TEST_CASE("Test rttr::type - MultipleClassInheritance", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("Test rttr::type - MultipleClassInheritance - pointer adjustment", "[type]")
+{
+    FinalClass final;
+    ClassMultipleBaseA& baseMultiA = final;
+    ClassMultiple3C& multi3C       = final;
+    ClassMultiple6E& multi6E       = final;
+
+    CHECK(rttr_cast<FinalClass*>(&baseMultiA) == &final);
+    CHECK(rttr_cast<FinalClass*>(&multi3C) == &final);
+    CHECK(rttr_cast<FinalClass*>(&multi6E) == &final);
+
+    CHECK(rttr_cast<ClassMultiple3C*>(&final) == &multi3C);
+    CHECK(rttr_cast<ClassMultiple6E*>(&final) == &multi6E);
+
+    // cross cast
+    CHECK(rttr_cast<ClassMultiple6E*>(&baseMultiA) == &multi6E);
+    CHECK(rttr_cast<ClassMultipleBaseA*>(&multi3C) == &baseMultiA);
+    CHECK(rttr_cast<ClassMultiple4D*>(&multi6E) == static_cast<ClassMultiple4D*>(&final));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("Test rttr::type - Virtual Inheritance", "[type]")
 {
     DiamondBottom diamond;
@@ -281,6 +303,31 @@ TEST_CASE("type - is_derived_from()", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("type - is_derived_from() and is_base_of() - class hierarchy", "[type]")
+{
+    CHECK(type::get<ClassMultiple6A>().is_derived_from<ClassMultipleBaseA>() == true);
+    CHECK(type::get<ClassMultiple6A>().is_derived_from<ClassMultiple3A>() == true);
+    CHECK(type::get<ClassMultiple6A>().is_derived_from<ClassMultiple6A>() == true);
+    CHECK(type::get<ClassMultiple6A>().is_derived_from<ClassMultipleBaseB>() == false);
+    CHECK(type::get<ClassMultiple3A>().is_derived_from<ClassMultiple6A>() == false);
+    CHECK(type::get<FinalClass>().is_derived_from<ClassMultiple4E>() == true);
+    CHECK(type::get<FinalClass>().is_derived_from<ClassSingleBase>() == false);
+    CHECK(type::get<int>().is_derived_from<ClassMultipleBaseA>() == false);
+
+    CHECK(type::get<ClassMultipleBaseA>().is_base_of<ClassMultiple6A>() == true);
+    CHECK(type::get<ClassMultipleBaseA>().is_base_of<FinalClass>() == true);
+    CHECK(type::get<ClassMultiple3A>().is_base_of<ClassMultiple3A>() == true);
+    CHECK(type::get<ClassMultiple6A>().is_base_of<ClassMultiple3A>() == false);
+    CHECK(type::get<ClassMultipleBaseB>().is_base_of<ClassMultiple6A>() == false);
+    CHECK(type::get<ClassMultipleBaseA>().is_base_of<int>() == false);
+
+    // the raw type is used for the check
+    CHECK(type::get<FinalClass*>().is_derived_from<ClassMultipleBaseC>() == true);
+    CHECK(type::get<const ClassMultipleBaseC>().is_base_of<FinalClass*>() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("Test rttr::type - TypeId/ClassInheritance", "[type]")
 {
     ClassSingle6A instance6A;